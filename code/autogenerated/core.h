@@ -79,6 +79,12 @@ const char* YOV_CORE = ""
 "ArrayRemove :: func(dst: Any, index: UInt);\n"
 "ArrayUnorderedRemove :: func(dst: Any, index: UInt);\n"
 "\n"
+"ArraySort         :: func(dst: Any, stable: Bool);\n"
+"ArraySortBy       :: func(dst: Any, member: String, stable: Bool);\n"
+"ArrayBinarySearch :: func(array: Any, value: Any) -> (index: UInt, found: Bool);\n"
+"ArrayUnique       :: func(dst: Any);\n"
+"ArraySlice        :: func(array: Any, begin: UInt, end: UInt) -> Any;\n"
+"\n"
 "ArrayMakeEmpty :: func(base_type: Type, dimensions: Array[UInt]) -> Any;\n"
 "\n"
 "ListMakeEmpty :: func(base_type: Type, dimensions: Array[UInt]) -> Any;\n"
@@ -134,8 +140,27 @@ const char* YOV_CORE = ""
 "StrAppend       :: func(str0: String, str1: String) -> String;\n"
 "StrEquals       :: func(str0: String, str1: String) -> Bool;\n"
 "StrSplit        :: func(str: String, separator: String) -> Array[String];\n"
+"StrSlice        :: func(str: String, begin: UInt, end: UInt) -> String;\n"
+"StrFind         :: func(str: String, pattern: String, cursor: UInt) -> (index: UInt, found: Bool);\n"
+"StrFindLast     :: func(str: String, pattern: String) -> (index: UInt, found: Bool);\n"
+"StrContains     :: func(str: String, pattern: String) -> Bool;\n"
+"StrCount        :: func(str: String, pattern: String) -> UInt;\n"
+"StrReplace      :: func(str: String, old_str: String, new_str: String) -> String;\n"
 "StrGetCodepoint :: func(str: String, cursor: UInt) -> (codepoint: UInt, next_cursor: UInt);\n"
+"StrCharCount    :: func(str: String) -> UInt;\n"
+"StrIsUtf8       :: func(str: String) -> Bool;\n"
 "StrFromCodepoint :: func(cp: UInt) -> String;\n"
+"ParseInt        :: func(str: String) -> (value: Int, result: Result);\n"
+"ParseFloat      :: func(str: String) -> (value: Float, result: Result);\n"
+"\n"
+"StringBuilder :: struct {\n"
+"    chunks: Array[String];\n"
+"    size: UInt;\n"
+"}\n"
+"\n"
+"StringBuilderAppend     :: func(builder: StringBuilder&, str: String);\n"
+"StringBuilderAppendLine :: func(builder: StringBuilder&, str: String);\n"
+"StringBuilderToString   :: func(builder: StringBuilder) -> String;\n"
 "\n"
 "PathAppend  :: func(path0: String, path1: String) -> String;\n"
 "PathResolve :: func(path: String) -> String;\n"
@@ -197,6 +222,7 @@ const char* YOV_CORE = ""
 "}\n"
 "\n"
 "YovParse :: func(path: String) -> YovParseOutput;\n"
+"YovTokenCount :: func(source: String) -> UInt;\n"
 "\n"
 "// User\n"
 "AskYesNo :: func(text: String) -> Bool;\n"
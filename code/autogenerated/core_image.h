@@ -0,0 +1,834 @@
+// Generated with 'yov -core_image', core.yov compiled into the definitions mapped at startup
+const U64 YOV_CORE_IMAGE[] = {
+0x2494F5659, 0x74CDABB883402CC0, 0x66F051EDD39AB7DB, 0x6EF0000CF88, 0x6EF00000068, 0x6EF00000758, 0x6EF00002318, 0x6EF00003ED8,
+0x10300005A98, 0x1D0000CE28, 0x6200009018, 0x190000C738, 0x1D0000CA88, 0x40C0410320C0C04, 0x40C0417040C0417, 0x410320C0C041117,
+0x417040C0417040C, 0x417040C0417040C, 0x320C0C041117040C, 0xC041117040C0410, 0x417040C0410320C, 0x417040C0417040C, 0xC04170F040E040C, 0x40C04170F040E04,
+0x410310C0C041117, 0x10320C0C0411040B, 0xC0C041117040C04, 0xB040B040B041031, 0x410320C0C041104, 0x300C0C041117040C, 0x17040D15040C0414, 0x40C0414300C0C04,
+0x414300C0C041715, 0x300C0C041715040C, 0xC041715040C0414, 0xD15040C0414300C, 0x414300C0C041704, 0xC0417040D15040C, 0x40B040C0414300C, 0xC0417040D15040C,
+0x1715040C0414300C, 0x40C0414300C0C04, 0x414300C0C041715, 0x40C04140D15040C, 0xC041715040C040B, 0xD15040C0414300C, 0x40C040B040C0414, 0x414300C0C041715,
+0x40C04140D15040C, 0x15040C040B0F040E, 0xC0414300C0C0417, 0x41715040C040B04, 0xB040C0414300C0C, 0xC0C041715040C04, 0xC040B040C041430, 0x14300C0C04171504,
+0x15040C040B040C04, 0xC0414300C0C0417, 0x41715040C040B04, 0xB040C0414300C0C, 0x15040C040B040C04, 0xC0414300C0C0417, 0x140D15040C040B04, 0x15040C040B040C04,
+0xC0414300C0C0417, 0x14300C0C04171504, 0xB040C040B040C04, 0x417040D15040C04, 0xB040C0414300C0C, 0xD150F040E040C04, 0x414300C0C041704, 0x40E040C040B040C,
+0x40C0417040D150F, 0x70C040C0417070C, 0x417070C040C0417, 0x40C0417070C040C, 0x70C040C0417070C, 0x417070C040C0417, 0x40C0417070C040C, 0x70C040C0417070C,
+0x417070C040C0417, 0x40C0417070C040C, 0x70C040C0417070C, 0x417070C040C0417, 0x40C0417070C040C, 0x70C040C0417070C, 0x417070C040C0417, 0x40C0417070C040C,
+0x70C040C0417070C, 0x417070C040C0417, 0x40C0417070C040C, 0x14300C0C0417070C, 0xC0C041715040C04, 0x41715040C041430, 0x300C0C0417300C0C, 0xC0C0417040D1514,
+0x41117040C041032, 0x15040C0414300C0C, 0xC040B040C04140D, 0x14300C0C04171504, 0x15040C040B040C04, 0xC040B040C04140D, 0x14300C0C04171504, 0xB040C040B040C04,
+0xC04140D15040C04, 0x41715040C040B04, 0xB040C0414300C0C, 0x417040D15040C04, 0xB040C0414300C0C, 0x417040D15040C04, 0xB040C0414300C0C, 0x40E040D15040C04,
+0x414300C0C04170F, 0x40B040C040B040C, 0xC0417040D15040C, 0x40B040C0414300C, 0xD15040C040B040C, 0x40C040B040C0414, 0x414300C0C041715, 0xD15040C040B040C,
+0x40C040B040C0414, 0x414300C0C041715, 0xD15040C040B040C, 0x414300C0C041704, 0xD15040C040B040C, 0x414300C0C041704, 0x40B040C040B040C, 0xC0417040D15040C,
+0x40B040C0414300C, 0x40C04140D15040C, 0xC041715040C040B, 0xD15040C0414300C, 0x414300C0C041704, 0xC0417040D15040C, 0xD15040C0414300C, 0x414300C0C041704,
+0x40C04140D15040C, 0xC041715040C040B, 0xD15040C0414300C, 0x40C040B040C0414, 0x410320C0C041715, 0xC04170F040E040C, 0x14300C0C04111704, 0x40C040B1E040C04,
+0x414300C0C041715, 0x15040C040B1E040C, 0xC0414300C0C0417, 0xC0C0417040D1504, 0xC040B040C041430, 0xC0C0417040D1504, 0x40D15040C041430, 0xD1514300C0C0417,
+0x1514300C0C041704, 0x14300C0C0417040D, 0x15040C040B040C04, 0x42404293410040D, 0xC041117042B042A, 0x40B040C0414300C, 0x293410040D15040C, 0x17042B042A042604,
+0xC0414300C0C0411, 0x40D15040C040B04, 0x42A042404293410, 0x300C0C041117042B, 0x40C040B040C0414, 0x2604293410040D15, 0x41117042B042A04, 0xB040C0414300C0C,
+0x3410040D15040C04, 0x42B042A04240429, 0x414300C0C041117, 0xD15040C040B040C, 0x2A04260429341004, 0xC0C041117042B04, 0xC0417040D151430, 0x40B040C0414300C,
+0xC0417040D15040C, 0x417040D1514300C, 0xB040C0414300C0C, 0x417040D15040C04, 0xB040C0414300C0C, 0x417040D15040C04, 0xB040C0414300C0C, 0x417040D15040C04,
+0x17040C0410320C0C, 0x17040C0417040C04, 0xC0410320C0C0411, 0xF040E040C041704, 0x170F040E040C0417, 0xC0410320C0C0411, 0xF040E040C041704, 0x410320C0C041117,
+0x40E040C0417040C, 0xF040E040C04170F, 0x410320C0C041117, 0xC04170F040E040C, 0x40C04170F040E04, 0xE040C04170F040E, 0x40E040C04170F04, 0xF040E040C04170F,
+0x414300C0C041117, 0xC0417040D15040C, 0xD15040C0414300C, 0x414300C0C041704, 0xC0417040D15040C, 0x110B040B0410310C, 0x40C0410320C0C04, 0xC041117040C0417,
+0xD15040C0414300C, 0x414300C0C041704, 0xD15040C040B040C, 0x414300C0C041704, 0xC0417040D15040C, 0x40B040C0414300C, 0xC0417040D15040C, 0x40B040C0414300C,
+0xC0417040D15040C, 0x40B040C0414300C, 0xD15040C040B040C, 0x414300C0C041704, 0xD15040C040B040C, 0x414300C0C041704, 0xC0417040D15040C, 0xD15040C0414300C,
+0x40C040B040C0414, 0x414300C0C041715, 0x40C04140D15040C, 0x15040C040B0F040E, 0xC0414300C0C0417, 0xB040C04140D1504, 0xC0C041715040C04, 0xC040B040C041430,
+0xC0C0417040D1504, 0xC0417040D151430, 0x17040D1514300C, 0x800000001, 0xB00000009, 0x1800000012, 0x200000001E, 0x2A00000024,
+0x3300000031, 0x3F00000039, 0x4500000043, 0x4A00000048, 0x550000004D, 0x5800000056, 0x650000005F, 0x6B00000069,
+0x7700000071, 0x800000007E, 0x8C00000086, 0x9300000091, 0x9D00000097, 0xA4000000A2, 0xAE000000A8, 0xB8000000B6,
+0xBE000000BC, 0xC6000000C1, 0xC9000000C7, 0xD6000000D0, 0xDC000000DA, 0xE4000000E2, 0xEF000000E7, 0xF2000000F0,
+0xFF000000F9, 0x10300000101, 0x10F00000109, 0x11B00000119, 0x12700000121, 0x13300000131, 0x13F00000139, 0x14500000143,
+0x14B0000014A, 0x15200000151, 0x15D00000158, 0x1640000015F, 0x16900000165, 0x1700000016A, 0x17600000174, 0x17C0000017A,
+0x1860000017F, 0x18900000187, 0x1940000018E, 0x19D0000019B, 0x1A6000001A3, 0x1AA000001A9, 0x1B3000001AC, 0x1BD000001B9,
+0x1C5000001BF, 0x1CA000001C7, 0x1DA000001D9, 0x1E1000001DC, 0x1EE000001E7, 0x1F6000001F0, 0x1FE000001F8, 0x20A00000200,
+0x21A0000020D, 0x21D0000021B, 0x22A00000224, 0x23B00000239, 0x24B00000249, 0x25F00000257, 0x26200000260, 0x26700000266,
+0x26F0000026D, 0x27400000272, 0x27B00000277, 0x2850000027D, 0x28800000286, 0x28D0000028C, 0x29500000293, 0x29900000298,
+0x2A30000029B, 0x2A6000002A4, 0x2AB000002AA, 0x2B3000002B1, 0x2B7000002B6, 0x2C1000002B9, 0x2C4000002C2, 0x2C9000002C8,
+0x2D4000002D2, 0x2D8000002D7, 0x2E2000002DA, 0x2E5000002E3, 0x2EA000002E9, 0x2EE000002EC, 0x2F6000002F4, 0x2FF000002F9,
+0x30900000301, 0x30C0000030A, 0x31100000310, 0x31900000317, 0x31F0000031D, 0x32800000322, 0x3320000032A, 0x33500000333,
+0x33A00000339, 0x34300000341, 0x34B00000349, 0x35600000354, 0x35B00000359, 0x3640000035E, 0x36F00000367, 0x37200000370,
+0x37700000376, 0x37B00000379, 0x3800000037F, 0x38A00000382, 0x38D0000038B, 0x39200000391, 0x39700000395, 0x39D0000039C,
+0x3AD000003A0, 0x3B0000003AE, 0x3B5000003B4, 0x3BB000003B9, 0x3C3000003C1, 0x3C7000003C6, 0x3CE000003CC, 0x3D6000003D4,
+0x3DE000003DC, 0x3E5000003E4, 0x3F4000003E7, 0x3F7000003F5, 0x3FC000003FB, 0x40200000400, 0x40A00000408, 0x40E0000040D,
+0x41500000413, 0x41D0000041B, 0x42500000423, 0x42C0000042B, 0x43B0000042E, 0x43E0000043C, 0x44300000442, 0x44900000447,
+0x4510000044F, 0x45500000454, 0x45C0000045A, 0x46200000461, 0x46900000468, 0x4710000046B, 0x47900000473, 0x66D0000047A,
+0x68600000685, 0x68C00000688, 0x6900000068D, 0x69500000692, 0x69A00000697, 0x69F0000069C, 0x6E0000006A0, 0x6F9000006F8,
+0x6FF000006FB, 0x70300000700, 0x70800000705, 0x70D0000070A, 0x7120000070F, 0x75300000713, 0x7600000075F, 0x76600000762,
+0x76A00000767, 0x76F0000076C, 0x77600000771, 0x77C00000778, 0x77F0000077D, 0x79500000794, 0x79B00000797, 0x79F0000079C,
+0x7A4000007A1, 0x7AB000007A6, 0x7B1000007AD, 0x7B5000007B2, 0x7C8000007C7, 0x7CE000007CA, 0x7D2000007CF, 0x7D7000007D4,
+0x7DF000007D9, 0x7E5000007E1, 0x7E8000007E6, 0x7FB000007FA, 0x801000007FD, 0x80500000802, 0x80A00000807, 0x8120000080C,
+0x81A00000814, 0x8220000081C, 0x82800000824, 0x82B00000829, 0x83E0000083D, 0x84400000840, 0x84A00000845, 0x84F0000084C,
+0x85600000851, 0x85B00000858, 0x8600000085D, 0x86600000861, 0x86C00000868, 0x8730000086E, 0x87900000875, 0x87C0000087A,
+0x88F0000088E, 0x89500000891, 0x89900000896, 0x89E0000089B, 0x8A10000089F, 0x8B4000008B3, 0x8BA000008B6, 0x8C0000008BB,
+0x8C5000008C2, 0x8CC000008C7, 0x8D2000008CE, 0x8D7000008D4, 0x8DD000008D9, 0x8E2000008DF, 0x8E8000008E5, 0x8F8000008F7,
+0x8FE000008FA, 0x908000008FF, 0x90E0000090A, 0x91A00000910, 0x9210000091C, 0x92600000922, 0x92900000927, 0x92F0000092C,
+0x94000000932, 0x94300000941, 0x94800000947, 0x95300000951, 0x95900000957, 0x96500000963, 0x96B0000096A, 0x9700000096F,
+0x97500000972, 0x98700000978, 0x99A00000998, 0x9A3000009A1, 0x9AE000009AC, 0x9C1000009BF, 0x9CA000009C8, 0x9D4000009D2,
+0x9E7000009E5, 0x9F0000009EE, 0x9FD000009FB, 0xA1000000A0E, 0xA1900000A17, 0xA2600000A24, 0xA3900000A37, 0xA4200000A40,
+0xA4D00000A4B, 0xA6200000A60, 0xA6B00000A69, 0xA7A00000A78, 0xA9000000A8E, 0xA9900000A97, 0xAA900000AA6, 0xABB00000AB9,
+0xAC400000AC2, 0xAD000000ACE, 0xAE200000AE0, 0xAEB00000AE9, 0xAF700000AF5, 0xB0900000B07, 0xB1200000B10, 0xB1E00000B1C,
+0xB3000000B2E, 0xB3900000B37, 0xB4500000B43, 0xB5700000B55, 0xB6000000B5E, 0xB6C00000B6A, 0xB7E00000B7C, 0xB8700000B85,
+0xB9300000B91, 0xBA500000BA3, 0xBAE00000BAC, 0xBBA00000BB8, 0xBCC00000BCA, 0xBD500000BD3, 0xBE100000BDF, 0xBF300000BF1,
+0xBFC00000BFA, 0xC0900000C06, 0xC1B00000C19, 0xC2400000C22, 0xC3000000C2E, 0xC4200000C40, 0xC4B00000C49, 0xC5700000C55,
+0xC6900000C67, 0xC7200000C70, 0xC7E00000C7C, 0xC9000000C8E, 0xC9900000C97, 0xCA500000CA3, 0xCB700000CB5, 0xCC000000CBE,
+0xCCC00000CCA, 0xCDE00000CDC, 0xCE700000CE5, 0xCF300000CF1, 0xD0500000D03, 0xD0E00000D0C, 0xD1A00000D18, 0xD2C00000D2A,
+0xD3500000D33, 0xD4200000D3F, 0xD5300000D51, 0xD5C00000D5A, 0xD6800000D65, 0xD7A00000D79, 0xD8000000D7C, 0xD8A00000D81,
+0xD9000000D8C, 0xD9300000D91, 0xDA100000DA0, 0xDA700000DA3, 0xDAD00000DA8, 0xDB500000DAF, 0xDB800000DB6, 0xDC600000DC5,
+0xDCC00000DC8, 0xDDA00000DCE, 0xDDD00000DDB, 0xDE200000DE1, 0xDE700000DE4, 0xE0300000DED, 0xE0F00000E0E, 0xE1800000E11,
+0xE2400000E1E, 0xE2C00000E26, 0xE3100000E2E, 0xE3E00000E3D, 0xE4400000E40, 0xE4C00000E45, 0xE5400000E4E, 0xE5900000E56,
+0xE5D00000E5A, 0xE6900000E5F, 0xE7100000E6B, 0xE7900000E73, 0xE7C00000E7A, 0xE8800000E87, 0xE8E00000E8A, 0xE9300000E8F,
+0xE9B00000E95, 0xEA600000E9D, 0xEAE00000EA8, 0xEB300000EB0, 0xEB700000EB4, 0xEC300000EB9, 0xECB00000EC5, 0xED300000ECD,
+0xED600000ED4, 0xEE200000EE1, 0xEE800000EE4, 0xEED00000EE9, 0xEF500000EEF, 0xF0000000EF7, 0xF0800000F02, 0xF1700000F0A,
+0xF1F00000F19, 0xF2400000F21, 0xF2800000F25, 0xF3400000F2A, 0xF3C00000F36, 0xF4400000F3E, 0xF5900000F45, 0xF6A00000F69,
+0xF7000000F6C, 0xF7500000F71, 0xF7D00000F77, 0xF8300000F7F, 0xF8B00000F85, 0xF9000000F8D, 0xF9800000F96, 0xFA900000FA8,
+0xFAF00000FAB, 0xFB400000FB0, 0xFBC00000FB6, 0xFC200000FBE, 0xFCA00000FC4, 0xFCF00000FCC, 0xFD500000FD3, 0xFE600000FE5,
+0xFEC00000FE8, 0xFF000000FED, 0xFF800000FF2, 0x100300000FFA, 0x100B00001005, 0x10100000100D, 0x101600001015, 0x101D0000101C,
+0x102F0000101F, 0x103200001030, 0x103700001036, 0x103C0000103A, 0x104400001042, 0x104B00001049, 0x10510000104F, 0x105600001054,
+0x105C0000105A, 0x10650000105F, 0x107700001067, 0x107A00001078, 0x107F0000107E, 0x108400001082, 0x108C0000108A, 0x109500001093,
+0x109D0000109B, 0x10A5000010A3, 0x10AB000010A9, 0x10AF000010AE, 0x10B6000010B4, 0x10BC000010BA, 0x10C3000010C1, 0x10C8000010C7,
+0x10DA000010CA, 0x10DD000010DB, 0x10E2000010E1, 0x10E7000010E5, 0x10EF000010ED, 0x10F8000010F6, 0x1100000010FE, 0x110400001103,
+0x110B00001109, 0x11110000110F, 0x111800001116, 0x111D0000111C, 0x112F0000111F, 0x113200001130, 0x113700001136, 0x113C0000113A,
+0x114400001142, 0x114D0000114B, 0x115500001153, 0x115C00001158, 0x116E0000115E, 0x11710000116F, 0x117600001175, 0x117B00001179,
+0x118300001181, 0x118C0000118A, 0x119400001192, 0x119B00001197, 0x11AD0000119D, 0x11B0000011AE, 0x11B5000011B4, 0x11BA000011B8,
+0x11C2000011C0, 0x11CB000011C9, 0x11D3000011D1, 0x11DC000011DA, 0x11E4000011E2, 0x11ED000011E7, 0x11FF000011EF, 0x120200001200,
+0x120700001206, 0x120C0000120A, 0x121400001212, 0x121C0000121A, 0x122200001220, 0x122600001225, 0x12310000122F, 0x123700001235,
+0x124400001242, 0x124900001248, 0x125B0000124B, 0x125E0000125C, 0x126300001262, 0x126800001266, 0x12700000126E, 0x127700001273,
+0x128900001279, 0x128C0000128A, 0x129100001290, 0x129600001294, 0x129E0000129C, 0x12A5000012A1, 0x12B8000012A7, 0x12BB000012B9,
+0x12C0000012BF, 0x12C4000012C2, 0x12CA000012C8, 0x12D3000012CD, 0x12E5000012D5, 0x12E8000012E6, 0x12ED000012EC, 0x12F2000012F0,
+0x12FA000012F8, 0x12FE000012FD, 0x130500001303, 0x130A00001308, 0x131200001310, 0x131900001318, 0x132B0000131B, 0x132E0000132C,
+0x133300001332, 0x133800001336, 0x13400000133E, 0x134400001343, 0x134B00001349, 0x135200001350, 0x135A00001358, 0x136100001360,
+0x137200001364, 0x137500001373, 0x13820000137C, 0x138A00001388, 0x13900000138F, 0x139700001396, 0x13A10000139D, 0x13A7000013A3,
+0x13AC000013A9, 0x13C5000013C4, 0x13CB000013C7, 0x13D3000013CC, 0x13E2000013D5, 0x13E5000013E3, 0x13EA000013E8, 0x13F1000013F0,
+0x140B000013F3, 0x140E0000140C, 0x141300001412, 0x141C0000141A, 0x142A00001429, 0x142F0000142C, 0x143700001431, 0x143A00001438,
+0x145300001452, 0x145900001455, 0x14610000145A, 0x147000001463, 0x147500001472, 0x147E0000147B, 0x148B0000148A, 0x14910000148D,
+0x149700001492, 0x149F00001499, 0x14A6000014A1, 0x14AE000014A8, 0x14B3000014B0, 0x14BB000014B9, 0x14C8000014C7, 0x14CE000014CA,
+0x14D3000014CF, 0x14DB000014D5, 0x14E0000014DD, 0x14F2000014E6, 0x14FF000014FE, 0x150500001501, 0x150800001506, 0x150F0000150B,
+0x151D00001511, 0x15200000151E, 0x152500001524, 0x152A00001527, 0x153B0000152F, 0x154100001540, 0x154700001543, 0x154A00001548,
+0x154F0000154C, 0x155300001551, 0x155800001555, 0x155D0000155A, 0x156300001561, 0x156D0000156A, 0x157200001570, 0x157A00001575,
+0x15820000157D, 0x158600001584, 0x158D00001588, 0x15900000158E, 0x159500001594, 0x159900001597, 0x159E0000159C, 0x15A2000015A0,
+0x15A7000015A5, 0x15AE000015AA, 0x15B7000015B0, 0x15BD000015BA, 0x15C2000015BF, 0x15CA000015C7, 0x15D1000015CF, 0x15D5000015D3,
+0x15DB000015DA, 0x15E1000015DD, 0x15E4000015E2, 0x15EA000015E6, 0x15EE000015EC, 0x15F4000015F0, 0x15F9000015F6, 0x1600000015FE,
+0x160A00001607, 0x160F0000160D, 0x161700001612, 0x161F0000161A, 0x162300001621, 0x162A00001625, 0x162D0000162B, 0x163200001631,
+0x163600001634, 0x163C0000163A, 0x16400000163E, 0x164600001644, 0x164E00001649, 0x165700001650, 0x165D0000165A, 0x16620000165F,
+0x166A00001667, 0x16710000166F, 0x167500001673, 0x167B0000167A, 0x16810000167D, 0x168400001682, 0x168B00001686, 0x168F0000168D,
+0x169600001691, 0x169B00001698, 0x16A3000016A1, 0x16AD000016AA, 0x16B2000016B0, 0x16BA000016B5, 0x16C2000016BD, 0x16C6000016C4,
+0x16CD000016C8, 0x16D0000016CE, 0x16D5000016D4, 0x16D9000016D7, 0x16E0000016DE, 0x16E4000016E2, 0x16EB000016E9, 0x16F4000016EE,
+0x16FD000016F6, 0x170300001700, 0x170800001705, 0x17100000170D, 0x171700001715, 0x171C00001719, 0x172400001723, 0x172A00001726,
+0x172D0000172B, 0x173400001730, 0x174200001736, 0x174500001743, 0x174A00001749, 0x174F0000174D, 0x175400001752, 0x175900001757,
+0x175E0000175C, 0x176400001761, 0x176F00001766, 0x177200001770, 0x177700001776, 0x177C00001779, 0x178C00001781, 0x179C0000179B,
+0x17A20000179E, 0x17A8000017A3, 0x17AE000017AA, 0x17B5000017B0, 0x17BB000017B7, 0x17C0000017BD, 0x17C8000017C6, 0x17D7000017D6,
+0x17DD000017D9, 0x17E3000017DE, 0x17E9000017E5, 0x17F0000017EB, 0x17F6000017F2, 0x17FB000017F8, 0x180300001801, 0x181200001811,
+0x181800001814, 0x181E00001819, 0x182400001820, 0x182B00001826, 0x18310000182D, 0x183600001833, 0x183F0000183C, 0x185100001850,
+0x185A00001853, 0x186A00001860, 0x18720000186C, 0x187C00001878, 0x18820000187E, 0x189300001888, 0x189900001895, 0x189E0000189B,
+0x18B2000018B1, 0x18BB000018B4, 0x18CB000018C1, 0x18D3000018CD, 0x18E3000018D9, 0x18EA000018E5, 0x18FB000018EB, 0x1902000018FC,
+0x190B00001909, 0x191100001910, 0x192200001921, 0x192700001924, 0x193900001938, 0x19420000193B, 0x195200001948, 0x195A00001954,
+0x196700001960, 0x196E00001969, 0x197F0000196F, 0x198200001980, 0x199400001985, 0x199700001995, 0x19A40000199E, 0x19B0000019AE,
+0x19BC000019B6, 0x19C6000019C4, 0x19CC000019CB, 0x19D3000019D2, 0x19DF000019D9, 0x19E6000019E1, 0x19EA000019E7, 0x19ED000019EB,
+0x19FF000019F0, 0x1A0200001A00, 0x1A0F00001A09, 0x1A1800001A16, 0x1A1E00001A1D, 0x1A2500001A24, 0x1A3400001A2B, 0x1A3B00001A36,
+0x1A4E00001A3C, 0x1A5500001A4F, 0x1A5E00001A5C, 0x1A6400001A63, 0x1A7500001A74, 0x1A8000001A7B, 0x1A8700001A82, 0x1A9600001A88,
+0x1A9D00001A97, 0x1AA600001AA4, 0x1AAC00001AAB, 0x1ABD00001ABC, 0x1ACA00001AC3, 0x1AD100001ACC, 0x1AD800001AD2, 0x1ADB00001AD9,
+0x1AE700001ADE, 0x1AEA00001AE8, 0x1AEF00001AEE, 0x1AF500001AF3, 0x1AFD00001AFB, 0x1B0E00001B00, 0x1B1E00001B10, 0x1B2100001B1F,
+0x1B2600001B25, 0x1B2E00001B2C, 0x1B3600001B34, 0x1B3D00001B39, 0x1B5100001B48, 0x1B5400001B52, 0x1B5900001B58, 0x1B5F00001B5D,
+0x1B6700001B65, 0x1B6E00001B6A, 0x1B8A00001B81, 0x1B8D00001B8B, 0x1B9800001B92, 0x1BA800001BA2, 0x1BB200001BB0, 0x1BBE00001BB5,
+0x1BC100001BBF, 0x1BCE00001BC8, 0x1BD400001BD2, 0x1BE000001BDA, 0x1BEE00001BEC, 0x1BF400001BF2, 0x1C0300001BF7, 0x1C0600001C04,
+0x1C0B00001C0A, 0x1C1100001C0F, 0x1C1900001C17, 0x1C2000001C1C, 0x1C2E00001C22, 0x1C3100001C2F, 0x1C3600001C35, 0x1C3C00001C3A,
+0x1C4400001C42, 0x1C4F00001C4D, 0x1C5500001C53, 0x1C5E00001C58, 0x1C6C00001C60, 0x1C6F00001C6D, 0x1C7400001C73, 0x1C7A00001C78,
+0x1C8200001C80, 0x1C8B00001C85, 0x1C9900001C8D, 0x1C9C00001C9A, 0x1CA100001CA0, 0x1CA600001CA4, 0x1CAE00001CAC, 0x1CB300001CB1,
+0x1CBB00001CB9, 0x1CC400001CBE, 0x1CD200001CC6, 0x1CD500001CD3, 0x1CDA00001CD9, 0x1CDF00001CDD, 0x1CE700001CE5, 0x1CEC00001CEA,
+0x1CF400001CF2, 0x1CFD00001CF7, 0x1D0B00001CFF, 0x1D0E00001D0C, 0x1D1300001D12, 0x1D1800001D16, 0x1D2000001D1E, 0x1D2500001D23,
+0x1D2D00001D2B, 0x1D3300001D31, 0x1D3D00001D3B, 0x1D4600001D40, 0x1D5400001D48, 0x1D5700001D55, 0x1D5C00001D5B, 0x1D6100001D5F,
+0x1D6900001D67, 0x1D6E00001D6C, 0x1D7600001D74, 0x1D7F00001D79, 0x1D8D00001D81, 0x1D9000001D8E, 0x1D9500001D94, 0x1D9B00001D99,
+0x1DA300001DA1, 0x1DAC00001DA6, 0x1DBA00001DAE, 0x1DBD00001DBB, 0x1DC200001DC1, 0x1DC800001DC6, 0x1DD000001DCE, 0x1DD400001DD3,
+0x1DDA00001DD8, 0x1DE400001DE2, 0x1DEC00001DEA, 0x1DF300001DF2, 0x1E0100001DF5, 0x1E0400001E02, 0x1E0900001E08, 0x1E0F00001E0D,
+0x1E1700001E15, 0x1E1B00001E1A, 0x1E2200001E20, 0x1E2800001E27, 0x1E3100001E30, 0x1E3900001E33, 0x1E4100001E3B, 0x1E4500001E42,
+0x1E5600001E55, 0x1E5C00001E58, 0x1E6100001E5D, 0x1E6900001E63, 0x1E6E00001E6B, 0x1E7600001E6F, 0x1E7E00001E78, 0x1E8600001E80,
+0x1E8E00001E88, 0x1E9100001E8F, 0x1EA200001EA1, 0x1EA800001EA4, 0x1EAD00001EA9, 0x1EB500001EAF, 0x1EBE00001EB7, 0x1EC600001EC0,
+0x1ECB00001EC8, 0x1EDD00001ED1, 0x1EEF00001EEE, 0x1EF500001EF1, 0x1EF800001EF6, 0x1F0100001EFB, 0x1F1400001F03, 0x1F1700001F15,
+0x1F1C00001F1B, 0x1F2100001F1E, 0x1F27, 0x100000006, 0x600000001, 0x600000001, 0x400000001, 0x700000001,
+0x600000001, 0x400000001, 0x300000001, 0x100000001, 0x100000007, 0x600000001, 0x400000001, 0x600000001,
+0x700000001, 0x600000001, 0x500000001, 0x400000001, 0x500000001, 0x400000001, 0x800000001, 0x400000001,
+0x100000001, 0x100000004, 0x600000001, 0x400000001, 0x600000001, 0x100000001, 0x100000007, 0x600000001,
+0x200000001, 0x600000001, 0xA00000001, 0x600000001, 0xA00000001, 0x600000001, 0x400000001, 0x500000001,
+0x600000001, 0x100000001, 0x100000005, 0x100000005, 0x100000004, 0x400000001, 0x400000001, 0x100000001,
+0x100000006, 0x400000001, 0x700000001, 0x500000001, 0x200000001, 0x100000001, 0x100000006, 0x100000004,
+0x100000006, 0xE00000001, 0x100000001, 0x100000004, 0x100000007, 0x100000006, 0x100000006, 0x100000009,
+0x10000000C, 0x600000001, 0xF00000001, 0xE00000001, 0x100000001, 0x100000006, 0x400000001, 0x600000001,
+0x300000001, 0x200000001, 0x100000004, 0x100000005, 0x400000001, 0x600000001, 0x300000001, 0x100000001,
+0x100000007, 0x400000001, 0x600000001, 0x300000001, 0x100000001, 0x100000004, 0x400000001, 0x900000001,
+0x300000001, 0x100000001, 0x100000005, 0x400000001, 0x200000001, 0x600000001, 0x200000001, 0x100000006,
+0x100000006, 0x400000001, 0x600000001, 0x400000001, 0x200000001, 0x100000006, 0x100000006, 0x400000001,
+0x700000001, 0x600000001, 0x900000001, 0x300000001, 0x200000001, 0x100000006, 0x100000007, 0x400000001,
+0x200000001, 0x400000001, 0x100000001, 0x100000005, 0x400000001, 0x300000001, 0x500000001, 0x100000001,
+0x100000003, 0x400000001, 0x400000001, 0x600000001, 0x200000001, 0x500000001, 0x600000001, 0x600000001,
+0x600000001, 0x100000001, 0x100000007, 0x400000001, 0x400000001, 0x600000001, 0x200000001, 0x500000001,
+0x600000001, 0x600000001, 0x600000001, 0x100000001, 0x10000000C, 0x400000001, 0x400000001, 0x600000001,
+0x200000001, 0x500000001, 0x500000001, 0x600000001, 0x100000001, 0x100000006, 0x100000006, 0xF00000001,
+0x100000001, 0x100000004, 0x100000003, 0x100000003, 0x100000003, 0x100000003, 0x1600000001, 0x100000001,
+0x100000004, 0x100000003, 0x100000003, 0x100000003, 0x100000003, 0xB00000001, 0x100000001, 0x100000004,
+0x100000003, 0x100000003, 0x100000005, 0x100000004, 0x1400000001, 0x100000001, 0x100000004, 0x100000003,
+0x100000003, 0x100000005, 0x100000004, 0x900000001, 0x100000001, 0x100000004, 0x100000003, 0x100000003,
+0x100000006, 0x100000004, 0xB00000001, 0x100000001, 0x100000004, 0x100000003, 0x100000003, 0x100000006,
+0x100000006, 0x100000006, 0x100000004, 0x1100000001, 0x100000001, 0x100000004, 0x100000005, 0x100000003,
+0x100000005, 0x100000003, 0x100000002, 0x100000005, 0x100000004, 0x100000005, 0x100000004, 0xB00000001,
+0x100000001, 0x100000004, 0x100000003, 0x100000003, 0xA00000001, 0x100000001, 0x100000004, 0x100000005,
+0x100000003, 0x100000005, 0x100000004, 0x100000003, 0x100000004, 0x300000002, 0xE00000001, 0x100000001,
+0x100000004, 0x100000009, 0x100000004, 0x10000000A, 0x100000005, 0x100000004, 0x200000001, 0x100000003,
+0x10000000D, 0x400000001, 0x900000001, 0x400000001, 0xA00000001, 0x500000001, 0x400000001, 0x100000001,
+0x300000002, 0xA00000001, 0x600000001, 0x900000001, 0x900000001, 0x600000001, 0x800000001, 0x1000000001,
+0x600000001, 0xB00000001, 0x1000000001, 0x600000001, 0xB00000001, 0xA00000001, 0x600000001, 0x900000001,
+0x1200000001, 0x600000001, 0xD00000001, 0x1300000001, 0x600000001, 0xD00000001, 0xD00000001, 0x600000001,
+0xA00000001, 0xB00000001, 0x600000001, 0xA00000001, 0xD00000001, 0x600000001, 0xA00000001, 0xE00000001,
+0x600000001, 0xA00000001, 0xC00000001, 0x600000001, 0xA00000001, 0xF00000001, 0x600000001, 0xA00000001,
+0xC00000001, 0x600000001, 0xA00000001, 0xD00000001, 0x600000001, 0xA00000001, 0xC00000001, 0x600000001,
+0xA00000001, 0xD00000001, 0x600000001, 0xA00000001, 0xB00000001, 0x600000001, 0xA00000001, 0xD00000001,
+0x600000001, 0xA00000001, 0xE00000001, 0x600000001, 0xA00000001, 0xC00000001, 0x600000001, 0xA00000001,
+0xF00000001, 0x600000001, 0xA00000001, 0xC00000001, 0x600000001, 0xA00000001, 0xD00000001, 0x600000001,
+0xA00000001, 0xE00000001, 0x600000001, 0x900000001, 0x1000000001, 0x100000001, 0x100000004, 0x100000009,
+0x100000004, 0xC00000001, 0x100000001, 0x100000004, 0x100000005, 0x100000006, 0xC00000001, 0x100000001,
+0x100000004, 0x10000000B, 0x400000001, 0x100000001, 0x600000002, 0xA00000001, 0x100000001, 0x100000006,
+0x100000006, 0x100000006, 0x400000001, 0x100000001, 0x100000004, 0x100000007, 0x100000006, 0x100000002,
+0x100000003, 0x10000000A, 0x100000006, 0x100000006, 0x700000001, 0x100000001, 0x100000004, 0x100000004,
+0x100000006, 0x100000009, 0x100000006, 0x100000002, 0x100000003, 0x10000000A, 0x100000006, 0x100000006,
+0xA00000001, 0x100000001, 0x100000004, 0x100000004, 0x100000006, 0x100000009, 0x100000006, 0x10000000D,
+0x100000006, 0x100000002, 0x100000003, 0x10000000A, 0x100000006, 0x100000006, 0x900000001, 0x100000001,
+0x100000004, 0x100000004, 0x100000006, 0x100000004, 0x100000006, 0x600000002, 0x900000001, 0x100000001,
+0x100000004, 0x100000004, 0x100000006, 0x100000004, 0x100000006, 0x400000002, 0x800000001, 0x100000001,
+0x100000004, 0x100000003, 0x100000006, 0x100000009, 0x100000006, 0x500000002, 0x600000001, 0x100000001,
+0x100000008, 0x400000001, 0x300000001, 0x600000001, 0x500000001, 0x400000001, 0x300000001, 0x400000001,
+0x200000001, 0x100000006, 0x100000007, 0x400000001, 0x300000001, 0x600000001, 0x700000001, 0x600000001,
+0x600000001, 0x400000001, 0x200000001, 0x500000001, 0x400000001, 0x500000001, 0x400000001, 0x100000001,
+0x10000000B, 0x400000001, 0x300000001, 0x600000001, 0x700000001, 0x600000001, 0x200000001, 0x500000001,
+0x400000001, 0x500000001, 0x400000001, 0x100000001, 0x10000000B, 0x400000001, 0x300000001, 0x600000001,
+0x700000001, 0x600000001, 0x200000001, 0x100000004, 0x100000008, 0x400000001, 0x300000001, 0x600000001,
+0x700000001, 0x600000001, 0x200000001, 0x100000004, 0x10000000A, 0x400000001, 0x300000001, 0x600000001,
+0x700000001, 0x600000001, 0x700000001, 0x600000001, 0x200000001, 0x100000006, 0x10000000F, 0x400000001,
+0x300000001, 0x600000001, 0x600000001, 0x400000001, 0x200000001, 0x900000001, 0x400000001, 0xB00000001,
+0x400000001, 0x100000001, 0x10000000C, 0x400000001, 0x300000001, 0x600000001, 0x200000001, 0x100000004,
+0x100000009, 0x400000001, 0x300000001, 0x600000001, 0x200000001, 0x100000004, 0x100000010, 0x400000001,
+0x200000001, 0x400000001, 0x200000001, 0x100000006, 0x100000008, 0x400000001, 0x300000001, 0x600000001,
+0x200000001, 0x500000001, 0x300000001, 0x600000001, 0x600000001, 0x100000001, 0x10000000A, 0x400000001,
+0x300000001, 0x600000001, 0x200000001, 0x500000001, 0x500000001, 0x600000001, 0x600000001, 0x100000001,
+0x10000000D, 0x600000001, 0x600000001, 0x500000001, 0x600000001, 0x100000001, 0x100000004, 0x100000004,
+0x1300000001, 0x100000001, 0x100000004, 0x100000007, 0x10000000D, 0x300000001, 0x600000001, 0x100000001,
+0x100000017, 0x400000001, 0x700000001, 0xD00000001, 0x100000001, 0x100000003, 0x100000006, 0x1500000001,
+0x100000001, 0x100000004, 0x100000007, 0x10000000D, 0x600000002, 0xA00000001, 0x100000001, 0x100000004,
+0x100000005, 0x100000006, 0x100000005, 0x100000006, 0x600000002, 0xB00000001, 0x100000001, 0x100000004,
+0x100000004, 0x100000006, 0x600000002, 0x900000001, 0x100000001, 0x100000004, 0x200000001, 0x100000004,
+0x10000000B, 0x400000001, 0x100000001, 0x500000002, 0x400000001, 0x100000001, 0x100000004, 0x100000002,
+0x100000003, 0x100000002, 0x100000003, 0x300000002, 0x600000001, 0x200000002, 0x200000001, 0x200000004,
+0x200000004, 0x100000001, 0x100000004, 0x400000001, 0x200000001, 0x300000001, 0x200000001, 0x300000001,
+0x200000001, 0x100000003, 0x200000006, 0x100000002, 0x400000002, 0x400000002, 0x100000002, 0x400000001,
+0x100000001, 0x100000004, 0x100000002, 0x100000004, 0x100000002, 0x100000004, 0x400000002, 0x600000001,
+0x200000002, 0x200000001, 0x200000004, 0x200000004, 0x100000001, 0x100000004, 0x400000001, 0x200000001,
+0x400000001, 0x200000001, 0x400000001, 0x200000001, 0x100000004, 0x200000006, 0x100000002, 0x400000002,
+0x400000002, 0x100000002, 0x400000001, 0x100000001, 0x100000004, 0x100000002, 0x100000005, 0x100000002,
+0x100000005, 0x500000002, 0x600000001, 0x200000002, 0x200000001, 0x200000004, 0x200000004, 0x100000001,
+0x100000004, 0x400000001, 0x200000001, 0x500000001, 0x200000001, 0x500000001, 0x200000001, 0x100000005,
+0x200000006, 0x100000002, 0x400000002, 0x400000002, 0x100000002, 0x600000001, 0x100000001, 0x100000004,
+0x200000001, 0x100000004, 0x10000000B, 0x400000001, 0x300000001, 0x300000001, 0x300000001, 0x300000001,
+0x200000001, 0x100000003, 0x100000008, 0x400000001, 0x100000001, 0x500000002, 0xA00000001, 0x100000001,
+0x100000004, 0x100000005, 0x100000004, 0x100000005, 0x100000004, 0x600000002, 0xD00000001, 0x100000001,
+0x100000004, 0x100000005, 0x100000004, 0x100000005, 0x100000004, 0x600000002, 0xD00000001, 0x100000001,
+0x100000004, 0x100000005, 0x100000004, 0x100000005, 0x100000004, 0x600000002, 0x1000000001, 0x100000001,
+0x100000006, 0x10000000A, 0x100000006, 0x100000004, 0x100000004, 0x10000000B, 0x100000004, 0x1200000001,
+0x100000001, 0x100000006, 0x10000000A, 0x100000006, 0x10000000A, 0x100000005, 0x100000010, 0x700000001,
+0x500000001, 0x1000000001, 0x100000001, 0x1000000001, 0x100000001, 0x100000006, 0x10000000A, 0x100000006,
+0x100000007, 0x100000005, 0x100000010, 0x100000001, 0x10000000E, 0x600000001, 0xA00000001, 0x600000001,
+0x800000001, 0x500000001, 0x600000001, 0x100000001, 0x100000006, 0x100000005, 0x100000003, 0x100000001,
+0x10000000E, 0x600000001, 0x700000001, 0x500000001, 0x600000001, 0x100000001, 0x100000009, 0x100000005,
+0x100000012, 0x700000001, 0x500000001, 0x1000000001, 0x100000001, 0x100000005, 0x100000005, 0x10000000E,
+0x700000001, 0x500000001, 0x1000000001, 0x100000001, 0x100000007, 0x100000005, 0x100000006, 0x100000001,
+0x100000008, 0x400000001, 0x400000001, 0x600000001, 0x200000001, 0x10000000E, 0x10000000D, 0x400000001,
+0x600000001, 0x600000001, 0x200000001, 0x100000004, 0x100000008, 0x400000001, 0x400000001, 0x600000001,
+0x200000001, 0x100000004, 0x100000008, 0x400000001, 0xA00000001, 0x800000001, 0x100000001, 0x100000008,
+0x600000001, 0x400000001, 0x600000001, 0xC00000001, 0x400000001, 0x100000001, 0x100000006, 0x400000001,
+0x400000001, 0x600000001, 0x200000001, 0x100000004, 0x100000009, 0x400000001, 0x400000001, 0x600000001,
+0x900000001, 0x400000001, 0x200000001, 0x100000006, 0x100000009, 0x400000001, 0x400000001, 0x600000001,
+0x200000001, 0x100000006, 0x100000007, 0x400000001, 0x300000001, 0x600000001, 0x300000001, 0x600000001,
+0x200000001, 0x100000006, 0x100000007, 0x400000001, 0x300000001, 0x600000001, 0x300000001, 0x600000001,
+0x200000001, 0x100000006, 0x100000008, 0x400000001, 0x300000001, 0x600000001, 0x300000001, 0x600000001,
+0x400000001, 0x800000001, 0x200000001, 0x100000006, 0x100000008, 0x400000001, 0x300000001, 0x600000001,
+0x300000001, 0x600000001, 0x200000001, 0x100000006, 0x10000000A, 0x400000001, 0x400000001, 0x600000001,
+0x200000001, 0x100000006, 0x10000000B, 0x400000001, 0x400000001, 0x600000001, 0x200000001, 0x400000001,
+0x800000001, 0x600000001, 0x600000001, 0x100000001, 0x10000000A, 0x400000001, 0x400000001, 0x600000001,
+0x200000001, 0x500000001, 0x500000001, 0x800000001, 0x100000001, 0x100000006, 0x100000006, 0xE00000001,
+0x100000001, 0x100000004, 0x100000004, 0x100000006, 0x100000002, 0x100000007, 0x100000006, 0x100000006,
+0x100000006, 0xF00000001, 0x100000001, 0x100000004, 0x100000004, 0x100000006, 0x100000007, 0x100000006,
+0x600000002, 0x1000000001, 0x100000001, 0x100000004, 0x200000001, 0x100000006, 0x100000010, 0x400000001,
+0x100000001, 0x600000002, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000011, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000002B, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000035, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF00000059, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF0000004C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x53FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000062, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x6CFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x79FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000083, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000008C,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000098, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000000A2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000000AC,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000000B6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000000C2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF000000D2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF000000DE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000000E8, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000000F2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000000FC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000106, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000110,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000011A, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000127, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000122, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x135FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x143FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x151FFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x15FFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x16DFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x17FFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x18DFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x197FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1A1FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1B3FFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x1C6FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1C5FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000001D9, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000001D8, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x27BFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x285FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000291, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x29EFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2A7FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2B1FFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2BFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2C9FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2DBFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x2E5FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x2F3FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x303FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x313FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000318, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000032A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000033E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000348, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000356, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000360,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000036E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000037E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000392, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF000003A2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000003AC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000003B6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000003C2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF000003CE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000003DA, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000003E4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF000003EE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000003F8, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000040A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000404, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x418FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000427, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x431FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x441FFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x44DFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x456FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000045F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x46FFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000047D, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000048A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x498FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x4A5FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000004B3,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000004C0,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x4CEFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x4DBFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000004E9, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000004F6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x504FFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x50AFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000051A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000523, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x533FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x543FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x553FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x568FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x580FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x577FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000057E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x591FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x58FFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005A9, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005A0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x5A7FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005D9, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005B4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x5BBFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005C2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x5C9FFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005D0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x5D7FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005E2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF000005EE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000005FA, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000607, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000615, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF0000061E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000062E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000063A, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000064A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000065A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000066E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000067E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF0000068A, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000696, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000006A0,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000006AA, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000006B7, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF000006B2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x6C1FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x6CBFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x6D9FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x6E2FFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFF000006EB, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF, 0x0, 0x1, 0x14, 0x26, 0x3B,
+0x4A, 0x4C, 0x4D, 0x61, 0x73, 0x88, 0x99, 0xAA,
+0xBE, 0xC0, 0xC1, 0xD2, 0xE4, 0xE6, 0xE7, 0xFB,
+0x10B, 0x123, 0x13B, 0x154, 0x16C, 0x17C, 0x17E, 0x17F,
+0x190, 0x1A3, 0x1A5, 0x1A6, 0x1B5, 0x1C7, 0x1C9, 0x1CA,
+0x1E3, 0x20A, 0x20C, 0x20D, 0x226, 0x24B, 0x24D, 0x24E,
+0x256, 0x257, 0x27D, 0x29B, 0x2B9, 0x2DA, 0x301, 0x32A,
+0x366, 0x367, 0x382, 0x39F, 0x3A0, 0x3E7, 0x42E, 0x47C,
+0x47D, 0x480, 0x4B3, 0x4B4, 0x4EF, 0x531, 0x573, 0x5AE,
+0x5E9, 0x629, 0x669, 0x66C, 0x66D, 0x6A2, 0x6E0, 0x715,
+0x753, 0x77F, 0x7B4, 0x7B5, 0x7E8, 0x82B, 0x87C, 0x8A1,
+0x8E7, 0x8E8, 0x931, 0x932, 0x97A, 0x97B, 0x986, 0x987,
+0x9AE, 0x9D4, 0x9FD, 0xA26, 0xA4D, 0xA7A, 0xAA8, 0xAA9,
+0xAD0, 0xAF7, 0xB1E, 0xB45, 0xB6C, 0xB93, 0xBBA, 0xBE1,
+0xC08, 0xC09, 0xC30, 0xC57, 0xC7E, 0xCA5, 0xCCC, 0xCF3,
+0xD1A, 0xD41, 0xD42, 0xD67, 0xD68, 0xD93, 0xDB8, 0xDCE,
+0xDEF, 0xDF0, 0xE02, 0xE03, 0xE1A, 0xE2E, 0xE30, 0xE31,
+0xE7C, 0xED6, 0xF47, 0xF48, 0xF58, 0xF59, 0xF98, 0xFD5,
+0x101F, 0x1067, 0x10CA, 0x111F, 0x115E, 0x119D, 0x11EF, 0x124B,
+0x1279, 0x12A7, 0x12D5, 0x131B, 0x1363, 0x1364, 0x137E, 0x1399,
+0x13A9, 0x13AB, 0x13AC, 0x13F3, 0x143A, 0x147D, 0x147E, 0x14BB,
+0x14E8, 0x14E9, 0x14F1, 0x14F2, 0x1511, 0x1531, 0x1532, 0x153A,
+0x153B, 0x1588, 0x15D5, 0x1625, 0x1675, 0x16C8, 0x171B, 0x171C,
+0x1736, 0x1766, 0x1783, 0x1784, 0x178B, 0x178C, 0x17C8, 0x1803,
+0x183E, 0x183F, 0x185C, 0x1874, 0x1884, 0x189B, 0x189D, 0x189E,
+0x18BD, 0x18D5, 0x18FE, 0x1924, 0x1926, 0x1927, 0x1944, 0x195C,
+0x1982, 0x1984, 0x1985, 0x19A0, 0x19B8, 0x19D5, 0x19ED, 0x19EF,
+0x19F0, 0x1A0B, 0x1A27, 0x1A51, 0x1A77, 0x1A99, 0x1ABF, 0x1ADB,
+0x1ADD, 0x1ADE, 0x1B10, 0x1B3F, 0x1B40, 0x1B48, 0x1B70, 0x1B71,
+0x1B80, 0x1B81, 0x1B94, 0x1BA4, 0x1BB2, 0x1BB4, 0x1BB5, 0x1BCA,
+0x1BDC, 0x1BF4, 0x1BF6, 0x1BF7, 0x1C22, 0x1C60, 0x1C8D, 0x1CC6,
+0x1CFF, 0x1D48, 0x1D81, 0x1DAE, 0x1DF5, 0x1E44, 0x1E45, 0x1E91,
+0x1ED3, 0x1ED4, 0x1EDC, 0x1EDD, 0x1F03, 0x1F29, 0x746C75736552, 0x64656C696166,
+0x6567617373656D, 0x65646F63, 0x6000062B8, 0x0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7000062C0, 0x1,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x4000062C8, 0x2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x400000000, 0x24,
+0x6F666E49766F59, 0x68746170, 0x6E6F6973726576, 0x726F6A616D, 0x726F6E696D, 0x6E6F697369766572, 0x400006348, 0x1,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x700006350, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x500006358, 0x3,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x500006360, 0x3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x800006368, 0x3,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000000000, 0x4800000040, 0x50, 0x65707954, 0x656D616E, 0x400006430,
+0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0, 0x747865746E6F43, 0x6463, 0x645F747069726373, 0x7269,
+0x645F72656C6C6163, 0x7269, 0x73677261, 0x7365707974, 0x64656573, 0x200006468, 0x1, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xA00006470, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xA00006480, 0x1, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x400006490, 0x4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x500006498, 0x5, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x4000064A0, 0x3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000000000, 0x6000000040, 0x9000000078,
+0x646E694B534F, 0x73776F646E6957, 0x78756E694C, 0x700006588, 0x500006590, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x0, 0x1, 0x534F, 0x646E696B, 0x4000065E0, 0x6, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x0, 0x7463657269646552, 0x74756F647453, 0x656C6F736E6F43, 0x65726F6E6749, 0x747069726353, 0x6E4574726F706D49,
+0x76, 0x700006620, 0x600006628, 0x600006630, 0x900006638, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0, 0x1, 0x2,
+0x3, 0x6E6F43736C6C6143, 0x74786574, 0x7463657269646572, 0x74756F6474735F, 0xF000066D8, 0x7, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x0, 0x666F65707954, 0x7463656A626F, 0x600006718, 0x8, 0x267, 0x272,
+0x6E7275746572, 0x600006740, 0x9, 0x277, 0x27B, 0x746E697250, 0x7463656A626F, 0x600006770,
+0x8, 0x28D, 0x298, 0x6E4C746E697250, 0x7463656A626F, 0x6000067A0, 0x8, 0x2AB,
+0x2B6, 0x74697845, 0x646F635F74697865, 0x65, 0x9000067D0, 0x2, 0x2C9, 0x2D7,
+0x4443746553, 0x6463, 0x200006808, 0x1, 0x2EA, 0x2F4, 0x6E7275746572, 0x600006830,
+0xA, 0x2F9, 0x2FF, 0x747265737341, 0x746C75736572, 0x600006860, 0x0, 0x311,
+0x31D, 0x6E7275746572, 0x600006888, 0xA, 0x322, 0x328, 0x64656C696146, 0x6567617373656D,
+0x646F635F74697865, 0x65, 0x7000068B8, 0x1, 0x33A, 0x349, 0x9000068C0, 0x2,
+0x34B, 0x359, 0x6E7275746572, 0x600006910, 0xA, 0x35E, 0x364, 0x734D7065656C53,
+0x736D, 0x200006940, 0x3, 0x377, 0x37F, 0x7065656C53, 0x636573, 0x300006970,
+0xB, 0x392, 0x39C, 0x766E45, 0x656D616E, 0x4000069A0, 0x1, 0x3B5,
+0x3C1, 0x65756C6176, 0x746C75736572, 0x5000069C8, 0x1, 0x3C7, 0x3D4, 0x6000069D0,
+0xA, 0x3D6, 0x3E4, 0x68746150766E45, 0x656D616E, 0x400006A20, 0x1, 0x3FC,
+0x408, 0x65756C6176, 0x746C75736572, 0x500006A48, 0x1, 0x40E, 0x41B, 0x600006A50,
+0xA, 0x41D, 0x42B, 0x4168746150766E45, 0x79617272, 0x656D616E, 0x400006AA8, 0x1,
+0x443, 0x44F, 0x65756C6176, 0x746C75736572, 0x500006AD0, 0x4, 0x455, 0x469,
+0x600006AD8, 0xA, 0x46B, 0x479, 0x7070417961727241, 0x6B636142646E65, 0x747364, 0x637273,
+0x300006B30, 0x8, 0x68D, 0x695, 0x300006B38, 0x8, 0x697, 0x69F,
+0x7070417961727241, 0x656D656C45646E65, 0x6B636142746E, 0x747364, 0x637273, 0x300006B98, 0x8, 0x700,
+0x708, 0x300006BA0, 0x8, 0x70A, 0x712, 0x6D65527961727241, 0x65766F, 0x747364,
+0x7865646E69, 0x300006BF8, 0x8, 0x767, 0x76F, 0x500006C00, 0x3, 0x771,
+0x77C, 0x6F6E557961727241, 0x6552646572656472, 0x65766F6D, 0x747364, 0x7865646E69, 0x300006C60, 0x8,
+0x79C, 0x7A4, 0x500006C68, 0x3, 0x7A6, 0x7B1, 0x726F537961727241, 0x74,
+0x747364, 0x656C62617473, 0x300006CC0, 0x8, 0x7CF, 0x7D7, 0x600006CC8, 0x0,
+0x7D9, 0x7E5, 0x726F537961727241, 0x794274, 0x747364, 0x7265626D656D, 0x656C62617473, 0x300006D20,
+0x8, 0x802, 0x80A, 0x600006D28, 0x1, 0x80C, 0x81A, 0x600006D30,
+0x0, 0x81C, 0x828, 0x6E69427961727241, 0x6372616553797261, 0x68, 0x7961727261, 0x65756C6176,
+0x500006DB0, 0x8, 0x845, 0x84F, 0x500006DB8, 0x8, 0x851, 0x85B,
+0x7865646E69, 0x646E756F66, 0x500006E00, 0x3, 0x861, 0x86C, 0x500006E08, 0x0,
+0x86E, 0x879, 0x696E557961727241, 0x657571, 0x747364, 0x300006E60, 0x8, 0x896,
+0x89E, 0x696C537961727241, 0x6563, 0x7961727261, 0x6E69676562, 0x646E65, 0x500006E98, 0x8,
+0x8BB, 0x8C5, 0x500006EA0, 0x3, 0x8C7, 0x8D2, 0x300006EA8, 0x3,
+0x8D4, 0x8DD, 0x6E7275746572, 0x600006F10, 0x8, 0x8E2, 0x8E5, 0x6B614D7961727241,
+0x7974706D4565, 0x7079745F65736162, 0x65, 0x6F69736E656D6964, 0x736E, 0x900006F48, 0x9, 0x8FF,
+0x90E, 0xA00006F58, 0xC, 0x910, 0x927, 0x6E7275746572, 0x600006FA8, 0x8,
+0x92C, 0x92F, 0x656B614D7473694C, 0x7974706D45, 0x7079745F65736162, 0x65, 0x6F69736E656D6964, 0x736E,
+0x900006FE0, 0x9, 0x948, 0x957, 0xA00006FF0, 0xC, 0x959, 0x970,
+0x6E7275746572, 0x600007040, 0x8, 0x975, 0x978, 0x43656C6F736E6F43, 0x6572756769666E6F, 0x646165725F776172,
+0x73, 0x900007078, 0x0, 0xD81, 0xD90, 0x57656C6F736E6F43, 0x65746972, 0x65756C6176,
+0x5000070B8, 0x1, 0xDA8, 0xDB5, 0x46656C6F736E6F43, 0x6873756C, 0x52656C6F736E6F43, 0x646165,
+0x6E7275746572, 0x600007100, 0x1, 0xDE7, 0xDED, 0x7074754F6C6C6143, 0x7475, 0x74756F647473,
+0x600007138, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0, 0x6C6C6143, 0x646E616D6D6F63, 0x700007170,
+0x1, 0xE45, 0xE54, 0x74756F, 0x746C75736572, 0x300007198, 0xD, 0xE5A,
+0xE69, 0x6000071A0, 0xA, 0xE6B, 0xE79, 0x6578456C6C6143, 0x68746170, 0x746E656D75677261,
+0x73, 0x4000071F0, 0x1, 0xE8F, 0xE9B, 0x9000071F8, 0x1, 0xE9D,
+0xEAE, 0x74756F, 0x746C75736572, 0x300007248, 0xD, 0xEB4, 0xEC3, 0x600007250,
+0xA, 0xEC5, 0xED3, 0x697263536C6C6143, 0x7470, 0x68746170, 0x746E656D75677261, 0x73,
+0x756772615F766F79, 0x73746E656D, 0x4000072A8, 0x1, 0xEE9, 0xEF5, 0x9000072B0, 0x1,
+0xEF7, 0xF08, 0xD000072C0, 0x1, 0xF0A, 0xF1F, 0x74756F, 0x746C75736572,
+0x300007330, 0xD, 0xF25, 0xF34, 0x600007338, 0xA, 0xF36, 0xF44,
+0x6E65707041727453, 0x64, 0x30727473, 0x31727473, 0x400007390, 0x1, 0xF71, 0xF7D,
+0x400007398, 0x1, 0xF7F, 0xF8B, 0x6E7275746572, 0x6000073E0, 0x1, 0xF90,
+0xF96, 0x6C61757145727453, 0x73, 0x30727473, 0x31727473, 0x400007418, 0x1, 0xFB0,
+0xFBC, 0x400007420, 0x1, 0xFBE, 0xFCA, 0x6E7275746572, 0x600007468, 0x0,
+0xFCF, 0xFD3, 0x74696C7053727453, 0x727473, 0x6F74617261706573, 0x72, 0x300007498, 0x1,
+0xFED, 0xFF8, 0x9000074A0, 0x1, 0xFFA, 0x100B, 0x6E7275746572, 0x6000074F0,
+0x4, 0x1010, 0x101D, 0x6563696C53727453, 0x727473, 0x6E69676562, 0x646E65, 0x300007520,
+0x1, 0x1037, 0x1042, 0x500007528, 0x3, 0x1044, 0x104F, 0x300007530,
+0x3, 0x1051, 0x105A, 0x6E7275746572, 0x600007598, 0x1, 0x105F, 0x1065,
+0x646E6946727453, 0x727473, 0x6E726574746170, 0x726F73727563, 0x3000075C8, 0x1, 0x107F, 0x108A,
+0x7000075D0, 0x1, 0x108C, 0x109B, 0x6000075D8, 0x3, 0x109D, 0x10A9,
+0x7865646E69, 0x646E756F66, 0x500007640, 0x3, 0x10AF, 0x10BA, 0x500007648, 0x0,
+0x10BC, 0x10C7, 0x4C646E6946727453, 0x747361, 0x727473, 0x6E726574746170, 0x3000076A0, 0x1,
+0x10E2, 0x10ED, 0x7000076A8, 0x1, 0x10EF, 0x10FE, 0x7865646E69, 0x646E756F66,
+0x5000076F0, 0x3, 0x1104, 0x110F, 0x5000076F8, 0x0, 0x1111, 0x111C,
+0x61746E6F43727453, 0x736E69, 0x727473, 0x6E726574746170, 0x300007750, 0x1, 0x1137, 0x1142,
+0x700007758, 0x1, 0x1144, 0x1153, 0x6E7275746572, 0x6000077A0, 0x0, 0x1158,
+0x115C, 0x746E756F43727453, 0x727473, 0x6E726574746170, 0x3000077D0, 0x1, 0x1176, 0x1181,
+0x7000077D8, 0x1, 0x1183, 0x1192, 0x6E7275746572, 0x600007820, 0x3, 0x1197,
+0x119B, 0x616C706552727453, 0x6563, 0x727473, 0x7274735F646C6F, 0x7274735F77656E, 0x300007858, 0x1,
+0x11B5, 0x11C0, 0x700007860, 0x1, 0x11C2, 0x11D1, 0x700007868, 0x1,
+0x11D3, 0x11E2, 0x6E7275746572, 0x6000078D0, 0x1, 0x11E7, 0x11ED, 0x6F43746547727453,
+0x746E696F706564, 0x727473, 0x726F73727563, 0x300007908, 0x1, 0x1207, 0x1212, 0x600007910,
+0x3, 0x1214, 0x1220, 0x6E696F7065646F63, 0x74, 0x7275635F7478656E, 0x726F73, 0x900007958,
+0x3, 0x1226, 0x1235, 0xB00007968, 0x3, 0x1237, 0x1248, 0x4372616843727453,
+0x746E756F, 0x727473, 0x3000079C8, 0x1, 0x1263, 0x126E, 0x6E7275746572, 0x6000079F0,
+0x3, 0x1273, 0x1277, 0x6674557349727453, 0x38, 0x727473, 0x300007A28, 0x1,
+0x1291, 0x129C, 0x6E7275746572, 0x600007A50, 0x0, 0x12A1, 0x12A5, 0x436D6F7246727453,
+0x746E696F7065646F, 0x7063, 0x200007A88, 0x3, 0x12C0, 0x12C8, 0x6E7275746572, 0x600007AB0,
+0x1, 0x12CD, 0x12D3, 0x746E496573726150, 0x727473, 0x300007AE0, 0x1, 0x12ED,
+0x12F8, 0x65756C6176, 0x746C75736572, 0x500007B08, 0x2, 0x12FE, 0x1308, 0x600007B10,
+0xA, 0x130A, 0x1318, 0x6F6C466573726150, 0x7461, 0x727473, 0x300007B68, 0x1,
+0x1333, 0x133E, 0x65756C6176, 0x746C75736572, 0x500007B90, 0xB, 0x1344, 0x1350,
+0x600007B98, 0xA, 0x1352, 0x1360, 0x7542676E69727453, 0x7265646C69, 0x736B6E756863, 0x657A6973,
+0x600007BF0, 0x4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x400007BF8, 0x3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x1800000000, 0x7542676E69727453, 0x7070417265646C69, 0x646E65, 0x7265646C697562, 0x727473, 0x700007C60, 0xE,
+0x13CC, 0x13E3, 0x300007C68, 0x1, 0x13E5, 0x13F0, 0x7542676E69727453, 0x7070417265646C69,
+0x656E694C646E65, 0x7265646C697562, 0x727473, 0x700007CC8, 0xE, 0x1413, 0x142A, 0x300007CD0,
+0x1, 0x142C, 0x1437, 0x7542676E69727453, 0x536F547265646C69, 0x676E697274, 0x7265646C697562, 0x700007D30,
+0xF, 0x145A, 0x1470, 0x6E7275746572, 0x600007D58, 0x1, 0x1475, 0x147B,
+0x6570704168746150, 0x646E, 0x3068746170, 0x3168746170, 0x500007D90, 0x1, 0x1492, 0x149F,
+0x500007D98, 0x1, 0x14A1, 0x14AE, 0x6E7275746572, 0x600007DE0, 0x1, 0x14B3,
+0x14B9, 0x6F73655268746150, 0x65766C, 0x68746170, 0x400007E18, 0x1, 0x14CF, 0x14DB,
+0x6E7275746572, 0x600007E40, 0x1, 0x14E0, 0x14E6, 0x6B636954656D6954, 0x73, 0x6E7275746572,
+0x600007E78, 0x3, 0x150B, 0x150F, 0x70616C45656D6954, 0x646573, 0x6E7275746572, 0x600007EB0,
+0xB, 0x152A, 0x152F, 0x496E694D, 0x3076, 0x3176, 0x200007EE0, 0x2,
+0x1548, 0x154F, 0x200007EE8, 0x2, 0x1551, 0x1558, 0x6E7275746572, 0x600007F30,
+0x2, 0x155D, 0x1560, 0x4978614D, 0x3076, 0x3176, 0x200007F60, 0x2,
+0x1595, 0x159C, 0x200007F68, 0x2, 0x159E, 0x15A5, 0x6E7275746572, 0x600007FB0,
+0x2, 0x15AA, 0x15AD, 0x556E694D, 0x3076, 0x3176, 0x200007FE0, 0x3,
+0x15E2, 0x15EA, 0x200007FE8, 0x3, 0x15EC, 0x15F4, 0x6E7275746572, 0x600008030,
+0x3, 0x15F9, 0x15FD, 0x5578614D, 0x3076, 0x3176, 0x200008060, 0x3,
+0x1632, 0x163A, 0x200008068, 0x3, 0x163C, 0x1644, 0x6E7275746572, 0x6000080B0,
+0x3, 0x1649, 0x164D, 0x466E694D, 0x3076, 0x3176, 0x2000080E0, 0xB,
+0x1682, 0x168B, 0x2000080E8, 0xB, 0x168D, 0x1696, 0x6E7275746572, 0x600008130,
+0xB, 0x169B, 0x16A0, 0x4678614D, 0x3076, 0x3176, 0x200008160, 0xB,
+0x16D5, 0x16DE, 0x200008168, 0xB, 0x16E0, 0x16E9, 0x6E7275746572, 0x6000081B0,
+0xB, 0x16EE, 0x16F3, 0x6D6F646E6152, 0x6E7275746572, 0x6000081E0, 0x3, 0x1730,
+0x1734, 0x61526D6F646E6152, 0x65676E, 0x6E696D, 0x78616D, 0x300008218, 0x2, 0x174A,
+0x1752, 0x300008220, 0x2, 0x1754, 0x175C, 0x6E7275746572, 0x600008268, 0x2,
+0x1761, 0x1764, 0x31306D6F646E6152, 0x6E7275746572, 0x600008298, 0xB, 0x177C, 0x1781,
+0x6975716552766F59, 0x6572, 0x726F6A616D, 0x726F6E696D, 0x5000082D0, 0x3, 0x17A3, 0x17AE,
+0x5000082D8, 0x3, 0x17B0, 0x17BB, 0x6E7275746572, 0x600008320, 0xA, 0x17C0,
+0x17C6, 0x6975716552766F59, 0x6E694D6572, 0x726F6A616D, 0x726F6E696D, 0x500008358, 0x3, 0x17DE,
+0x17E9, 0x500008360, 0x3, 0x17EB, 0x17F6, 0x6E7275746572, 0x6000083A8, 0xA,
+0x17FB, 0x1801, 0x6975716552766F59, 0x78614D6572, 0x726F6A616D, 0x726F6E696D, 0x5000083E0, 0x3,
+0x1819, 0x1824, 0x5000083E8, 0x3, 0x1826, 0x1831, 0x6E7275746572, 0x600008430,
+0xA, 0x1836, 0x183C, 0x65447463656A624F, 0x6E6F6974696E6966, 0x696669746E656469, 0x7265, 0x65707974,
+0x74736E6F635F7369, 0x746E61, 0xA00008468, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x400008478, 0x9,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xB00008480, 0x0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000000000, 0x40,
+0x6E6F6974636E7546, 0x6974696E69666544, 0x6E6F, 0x696669746E656469, 0x7265, 0x6574656D61726170, 0x7372, 0x736E7275746572,
+0xA00008518, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xA00008528, 0x10, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x700008538, 0x10, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000000000, 0x38, 0x6544746375727453, 0x6E6F6974696E6966,
+0x696669746E656469, 0x7265, 0x737265626D656D, 0xA000085C0, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7000085D0,
+0x10, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000000000, 0x696665446D756E45, 0x6E6F6974696E, 0x696669746E656469, 0x7265,
+0x73746E656D656C65, 0x7365756C6176, 0xA00008630, 0x1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x800008640, 0x4,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x600008648, 0x11, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000000000, 0x38,
+0x6573726150766F59, 0x74757074754F, 0x73747069726373, 0x6E6F6974636E7566, 0x73, 0x73746375727473, 0x736D756E65, 0x736C61626F6C67,
+0x7374726F706572, 0x7000086D0, 0x4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x9000086D8, 0x12, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x7000086E8, 0x13, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x5000086F0, 0x14, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x7000086F8, 0x10, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x700008700, 0x4, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1800000000, 0x4800000030, 0x7800000060, 0x6573726150766F59, 0x68746170, 0x4000087E8, 0x1,
+0x1AEF, 0x1AFB, 0x6E7275746572, 0x600008810, 0x15, 0x1B00, 0x1B0E, 0x6E656B6F54766F59,
+0x746E756F43, 0x656372756F73, 0x600008848, 0x1, 0x1B26, 0x1B34, 0x6E7275746572, 0x600008870,
+0x3, 0x1B39, 0x1B3D, 0x6F4E7365596B7341, 0x74786574, 0x4000088A0, 0x1, 0x1B59,
+0x1B65, 0x6E7275746572, 0x6000088C8, 0x0, 0x1B6A, 0x1B6E, 0x65646F4D79706F43, 0x69727265764F6F4E,
+0x6564, 0x656469727265764F, 0xA000088F8, 0x800008908, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0x0, 0x1, 0x6F666E49656C6946, 0x68746170, 0x63657269645F7369, 0x79726F74, 0x400008958, 0x1,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xC00008960, 0x0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000000000, 0x737473697845,
+0x68746170, 0x4000089C0, 0x1, 0x1C0B, 0x1C17, 0x6E7275746572, 0x6000089E8, 0x0,
+0x1C1C, 0x1C20, 0x7461657243726944, 0x65, 0x68746170, 0x7669737275636572, 0x65, 0x400008A20,
+0x1, 0x1C36, 0x1C42, 0x900008A28, 0x0, 0x1C44, 0x1C53, 0x6E7275746572,
+0x600008A78, 0xA, 0x1C58, 0x1C5E, 0x74656C6544726944, 0x65, 0x68746170, 0x400008AB0,
+0x1, 0x1C74, 0x1C80, 0x6E7275746572, 0x600008AD8, 0xA, 0x1C85, 0x1C8B,
+0x79706F43726944, 0x747364, 0x637273, 0x300008B08, 0x1, 0x1CA1, 0x1CAC, 0x300008B10,
+0x1, 0x1CAE, 0x1CB9, 0x6E7275746572, 0x600008B58, 0xA, 0x1CBE, 0x1CC4,
+0x65766F4D726944, 0x747364, 0x637273, 0x300008B88, 0x1, 0x1CDA, 0x1CE5, 0x300008B90,
+0x1, 0x1CE7, 0x1CF2, 0x6E7275746572, 0x600008BD8, 0xA, 0x1CF7, 0x1CFD,
+0x79706F43656C6946, 0x747364, 0x637273, 0x65646F6D, 0x300008C08, 0x1, 0x1D13, 0x1D1E,
+0x300008C10, 0x1, 0x1D20, 0x1D2B, 0x400008C18, 0x16, 0x1D2D, 0x1D3B,
+0x6E7275746572, 0x600008C80, 0xA, 0x1D40, 0x1D46, 0x65766F4D656C6946, 0x747364, 0x637273,
+0x300008CB0, 0x1, 0x1D5C, 0x1D67, 0x300008CB8, 0x1, 0x1D69, 0x1D74,
+0x6E7275746572, 0x600008D00, 0xA, 0x1D79, 0x1D7F, 0x656C6544656C6946, 0x6574, 0x68746170,
+0x400008D38, 0x1, 0x1D95, 0x1DA1, 0x6E7275746572, 0x600008D60, 0xA, 0x1DA6,
+0x1DAC, 0x49746547656C6946, 0x6F666E, 0x68746170, 0x400008D98, 0x1, 0x1DC2, 0x1DCE,
+0x6F666E69, 0x746C75736572, 0x400008DC0, 0x17, 0x1DD4, 0x1DE2, 0x600008DC8, 0xA,
+0x1DE4, 0x1DF2, 0x6E49746547726944, 0x6F66, 0x68746170, 0x400008E20, 0x1, 0x1E09,
+0x1E15, 0x736F666E69, 0x746C75736572, 0x500008E48, 0x18, 0x1E1B, 0x1E31, 0x600008E50,
+0xA, 0x1E33, 0x1E41, 0x69746E4564616552, 0x656C69466572, 0x68746170, 0x400008EA8, 0x1,
+0x1E5D, 0x1E69, 0x746E65746E6F63, 0x746C75736572, 0x700008ED0, 0x1, 0x1E6F, 0x1E7E,
+0x600008ED8, 0xA, 0x1E80, 0x1E8E, 0x746E456574697257, 0x656C6946657269, 0x68746170, 0x746E65746E6F63,
+0x400008F30, 0x1, 0x1EA9, 0x1EB5, 0x700008F38, 0x1, 0x1EB7, 0x1EC6,
+0x6E7275746572, 0x600008F80, 0xA, 0x1ECB, 0x1ED1, 0x6F706D496376734D, 0x343658766E457472, 0x6E7275746572,
+0x600008FB8, 0xA, 0x1EFB, 0x1F01, 0x6F706D496376734D, 0x363858766E457472, 0x6E7275746572, 0x600008FF0,
+0xA, 0x1F21, 0x1F27, 0x2, 0x6000062B0, 0x0, 0x4B, 0x11,
+0x4B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x3000062D0,
+0x0, 0x0, 0x0, 0x300006330, 0x10000002C, 0x2, 0x700006340, 0x4B,
+0xBF, 0x5E, 0xBF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x500006370, 0x0, 0x0, 0x0, 0x500006410, 0x100000058, 0x2,
+0x400006428, 0xBF, 0xE5, 0xCF, 0xE5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006438, 0x0, 0x0, 0x0, 0x100006458,
+0x100000020, 0x2, 0x700006460, 0xE5, 0x17D, 0xF8, 0x17D, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x6000064A8, 0x0, 0x0,
+0x0, 0x600006568, 0x100000098, 0x3, 0x600006580, 0x17D, 0x1A4, 0x18D,
+0x1A4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0,
+0x0, 0x200006598, 0x2000065A8, 0x2000065C8, 0x0, 0x2, 0x2000065D8, 0x1A4,
+0x1C8, 0x1B2, 0x1C8, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1000065E8, 0x0, 0x0, 0x0, 0x100006608, 0x8, 0x3,
+0xE00006610, 0x1C8, 0x20B, 0x1E0, 0x20B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0, 0x0, 0x400006648, 0x400006668, 0x4000066A8,
+0x0, 0x2, 0xC000066C8, 0x20B, 0x24C, 0x223, 0x24C, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1000066E8, 0x0, 0x0,
+0x0, 0x100006708, 0x8, 0x1, 0x600006710, 0x24C, 0x27C, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x267, 0x272, 0x277, 0x27B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006720,
+0x100006748, 0x0, 0x0, 0x0, 0x0, 0x1, 0x500006768, 0x27C,
+0x29A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x28D, 0x298, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x100006778, 0x6798, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x700006798, 0x29A, 0x2B8, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2AB, 0x2B6, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1000067A8, 0x67C8, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x4000067C8, 0x2B8, 0x2D9, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2C9,
+0x2D7, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1000067E0, 0x6800, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x500006800, 0x2D9, 0x300, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x2EA, 0x2F4, 0x2F9, 0x2FF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006810,
+0x100006838, 0x0, 0x0, 0x0, 0x0, 0x1, 0x600006858, 0x300,
+0x329, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x311, 0x31D, 0x322, 0x328, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x100006868, 0x100006890, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x6000068B0, 0x329, 0x365, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x33A, 0x359, 0x35E,
+0x364, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000068D0, 0x100006918, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x700006938, 0x365, 0x381, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x377,
+0x37F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006948, 0x6968, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x500006968, 0x381, 0x39E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x392, 0x39C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006978,
+0x6998, 0x0, 0x0, 0x0, 0x0, 0x100000001, 0x300006998, 0x39E,
+0x3E6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x3B5, 0x3C1, 0x3C7, 0x3E4, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1000069A8, 0x2000069D8, 0x0, 0x0, 0x0, 0x0, 0x100000001,
+0x700006A18, 0x3E6, 0x42D, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x3FC, 0x408, 0x40E,
+0x42B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006A28, 0x200006A58, 0x0, 0x0, 0x0,
+0x0, 0x100000001, 0xC00006A98, 0x42D, 0x47B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x443,
+0x44F, 0x455, 0x479, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006AB0, 0x200006AE0, 0x0,
+0x0, 0x0, 0x0, 0x1, 0xF00006B20, 0x47B, 0x6A1, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x68D, 0x69F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200006B40,
+0x6B80, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1600006B80, 0x6A1,
+0x714, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x700, 0x712, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x200006BA8, 0x6BE8, 0x0, 0x0, 0x0, 0x0, 0x1,
+0xB00006BE8, 0x714, 0x77E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x767, 0x77C, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200006C08, 0x6C48, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x1400006C48, 0x77E, 0x7B3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x79C,
+0x7B1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200006C70, 0x6CB0, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x900006CB0, 0x7B3, 0x7E7, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x7CF, 0x7E5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200006CD0,
+0x6D10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xB00006D10, 0x7E7,
+0x82A, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x802, 0x828, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x300006D38, 0x6D98, 0x0, 0x0, 0x0, 0x0, 0x100000001,
+0x1100006D98, 0x82A, 0x87B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x845, 0x85B, 0x861,
+0x879, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200006DC0, 0x200006E10, 0x0, 0x0, 0x0,
+0x0, 0x1, 0xB00006E50, 0x87B, 0x8A0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x896,
+0x89E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100006E68, 0x6E88, 0x0,
+0x0, 0x0, 0x0, 0x1, 0xA00006E88, 0x8A0, 0x8E6, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x8BB, 0x8DD, 0x8E2, 0x8E5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x300006EB0,
+0x100006F18, 0x0, 0x0, 0x0, 0x0, 0x1, 0xE00006F38, 0x8E6,
+0x930, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x8FF, 0x927, 0x92C, 0x92F, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x200006F68, 0x100006FB0, 0x0, 0x0, 0x0, 0x0, 0x1,
+0xD00006FD0, 0x930, 0x979, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x948, 0x970, 0x975,
+0x978, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007000, 0x100007048, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x1000007068, 0xD66, 0xD92, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xD81,
+0xD90, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100007088, 0x70A8, 0x0,
+0x0, 0x0, 0x0, 0x1, 0xC000070A8, 0xD92, 0xDB7, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xDA8, 0xDB5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1000070C0,
+0x70E0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xC000070E0, 0xDB7,
+0xDCD, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x70F0, 0x70F0, 0x0, 0x0, 0x0, 0x0, 0x1,
+0xB000070F0, 0xDCD, 0xDEE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xDE2, 0xDE2, 0xDE7,
+0xDED, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7100, 0x100007108, 0x0, 0x0, 0x0,
+0x0, 0x2, 0xA00007128, 0xDEE, 0xE2F, 0xE17, 0xE2F, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100007140, 0x0, 0x0,
+0x0, 0x100007160, 0x100000020, 0x100000001, 0x400007168, 0xE2F, 0xE7B, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xE45, 0xE54, 0xE5A, 0xE79, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100007178,
+0x2000071A8, 0x0, 0x0, 0x0, 0x0, 0x100000001, 0x7000071E8, 0xE7B,
+0xED5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xE8F, 0xEAE, 0xEB4, 0xED3, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x200007208, 0x200007258, 0x0, 0x0, 0x0, 0x0, 0x100000001,
+0xA00007298, 0xED5, 0xF46, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xEE9, 0xF1F, 0xF25,
+0xF44, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x3000072D0, 0x200007340, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x900007380, 0xF46, 0xF97, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xF71,
+0xF8B, 0xF90, 0xF96, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000073A0, 0x1000073E8, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x900007408, 0xF97, 0xFD4, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFB0, 0xFCA, 0xFCF, 0xFD3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007428,
+0x100007470, 0x0, 0x0, 0x0, 0x0, 0x1, 0x800007490, 0xFD4,
+0x101E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFED, 0x100B, 0x1010, 0x101D, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x2000074B0, 0x1000074F8, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x800007518, 0x101E, 0x1066, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1037, 0x105A, 0x105F,
+0x1065, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x300007538, 0x1000075A0, 0x0, 0x0, 0x0,
+0x0, 0x100000001, 0x7000075C0, 0x1066, 0x10C9, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x107F,
+0x10A9, 0x10AF, 0x10C7, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x3000075E0, 0x200007650, 0x0,
+0x0, 0x0, 0x0, 0x100000001, 0xB00007690, 0x10C9, 0x111E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x10E2, 0x10FE, 0x1104, 0x111C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000076B0,
+0x200007700, 0x0, 0x0, 0x0, 0x0, 0x1, 0xB00007740, 0x111E,
+0x115D, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1137, 0x1153, 0x1158, 0x115C, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x200007760, 0x1000077A8, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x8000077C8, 0x115D, 0x119C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1176, 0x1192, 0x1197,
+0x119B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000077E0, 0x100007828, 0x0, 0x0, 0x0,
+0x0, 0x1, 0xA00007848, 0x119C, 0x11EE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x11B5,
+0x11E2, 0x11E7, 0x11ED, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x300007870, 0x1000078D8, 0x0,
+0x0, 0x0, 0x0, 0x100000001, 0xF000078F8, 0x11EE, 0x124A, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1207, 0x1220, 0x1226, 0x1248, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007918,
+0x200007978, 0x0, 0x0, 0x0, 0x0, 0x1, 0xC000079B8, 0x124A,
+0x1278, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1263, 0x126E, 0x1273, 0x1277, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1000079D0, 0x1000079F8, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x900007A18, 0x1278, 0x12A6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1291, 0x129C, 0x12A1,
+0x12A5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100007A30, 0x100007A58, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x1000007A78, 0x12A6, 0x12D4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x12C0,
+0x12C8, 0x12CD, 0x12D3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100007A90, 0x100007AB8, 0x0,
+0x0, 0x0, 0x0, 0x100000001, 0x800007AD8, 0x12D4, 0x131A, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x12ED, 0x12F8, 0x12FE, 0x1318, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100007AE8,
+0x200007B18, 0x0, 0x0, 0x0, 0x0, 0x100000001, 0xA00007B58, 0x131A,
+0x1362, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1333, 0x133E, 0x1344, 0x1360, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x100007B70, 0x200007BA0, 0x0, 0x0, 0x0, 0x0, 0x2,
+0xD00007BE0, 0x1362, 0x13AA, 0x137B, 0x13AA, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007C00, 0x0, 0x0, 0x0, 0x200007C40,
+0x100000020, 0x1, 0x1300007C48, 0x13AA, 0x13F2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x13CC,
+0x13F0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007C70, 0x7CB0, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x1700007CB0, 0x13F2, 0x1439, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1413, 0x1437, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007CD8,
+0x7D18, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1500007D18, 0x1439,
+0x147C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x145A, 0x1470, 0x1475, 0x147B, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x100007D38, 0x100007D60, 0x0, 0x0, 0x0, 0x0, 0x1,
+0xA00007D80, 0x147C, 0x14BA, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1492, 0x14AE, 0x14B3,
+0x14B9, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007DA0, 0x100007DE8, 0x0, 0x0, 0x0,
+0x0, 0x1, 0xB00007E08, 0x14BA, 0x14E7, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x14CF,
+0x14DB, 0x14E0, 0x14E6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100007E20, 0x100007E48, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x900007E68, 0x14E7, 0x1510, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1506, 0x1506, 0x150B, 0x150F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7E78,
+0x100007E80, 0x0, 0x0, 0x0, 0x0, 0x1, 0xB00007EA0, 0x1510,
+0x1530, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1525, 0x1525, 0x152A, 0x152F, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x7EB0, 0x100007EB8, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x400007ED8, 0x1530, 0x1587, 0x1560, 0x1587, 0x1548, 0x1558, 0x155D,
+0x1560, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007EF0, 0x100007F38, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x400007F58, 0x1587, 0x15D4, 0x15AD, 0x15D4, 0x1595,
+0x15A5, 0x15AA, 0x15AD, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007F70, 0x100007FB8, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x400007FD8, 0x15D4, 0x1624, 0x15FD,
+0x1624, 0x15E2, 0x15F4, 0x15F9, 0x15FD, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200007FF0,
+0x100008038, 0x0, 0x0, 0x0, 0x0, 0x1, 0x400008058, 0x1624,
+0x1674, 0x164D, 0x1674, 0x1632, 0x1644, 0x1649, 0x164D, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x200008070, 0x1000080B8, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x4000080D8, 0x1674, 0x16C7, 0x16A0, 0x16C7, 0x1682, 0x1696, 0x169B,
+0x16A0, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000080F0, 0x100008138, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x400008158, 0x16C7, 0x171A, 0x16F3, 0x171A, 0x16D5,
+0x16E9, 0x16EE, 0x16F3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200008170, 0x1000081B8, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x6000081D8, 0x171A, 0x1735, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x172B, 0x172B, 0x1730, 0x1734, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x81E0,
+0x1000081E8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xB00008208, 0x1735,
+0x1765, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x174A, 0x175C, 0x1761, 0x1764, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x200008228, 0x100008270, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x800008290, 0x1765, 0x1782, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1777, 0x1777, 0x177C,
+0x1781, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x8298, 0x1000082A0, 0x0, 0x0, 0x0,
+0x0, 0x1, 0xA000082C0, 0x1782, 0x17C7, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x17A3,
+0x17BB, 0x17C0, 0x17C6, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000082E0, 0x100008328, 0x0,
+0x0, 0x0, 0x0, 0x1, 0xD00008348, 0x17C7, 0x1802, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x17DE, 0x17F6, 0x17FB, 0x1801, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200008368,
+0x1000083B0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xD000083D0, 0x1802,
+0x183D, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1819, 0x1831, 0x1836, 0x183C, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x2000083F0, 0x100008438, 0x0, 0x0, 0x0, 0x0, 0x2,
+0x1000008458, 0x183D, 0x189C, 0x1859, 0x189C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x300008490, 0x0, 0x0, 0x0, 0x3000084F0,
+0x100000044, 0x2, 0x1200008500, 0x189C, 0x1925, 0x18BA, 0x1925, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x300008540, 0x0, 0x0,
+0x0, 0x3000085A0, 0x100000050, 0x2, 0x10000085B0, 0x1925, 0x1983, 0x1941,
+0x1983, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x2000085D8,
+0x0, 0x0, 0x0, 0x200008618, 0x100000038, 0x2, 0xE00008620, 0x1983,
+0x19EE, 0x199D, 0x19EE, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x300008650, 0x0, 0x0, 0x0, 0x3000086B0, 0x100000050, 0x2,
+0xE000086C0, 0x19EE, 0x1ADC, 0x1A08, 0x1ADC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x600008708, 0x0, 0x0, 0x0, 0x6000087C8,
+0x100000090, 0x1, 0x8000087E0, 0x1ADC, 0x1B0F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1AEF,
+0x1AFB, 0x1B00, 0x1B0E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1000087F0, 0x100008818, 0x0,
+0x0, 0x0, 0x0, 0x1, 0xD00008838, 0x1B0F, 0x1B3E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1B26, 0x1B34, 0x1B39, 0x1B3D, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100008850,
+0x100008878, 0x0, 0x0, 0x0, 0x0, 0x1, 0x800008898, 0x1B3E,
+0x1B6F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1B59, 0x1B65, 0x1B6A, 0x1B6E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1000088A8, 0x1000088D0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x8000088F0, 0x1B6F, 0x1BB3, 0x1B91, 0x1BB3, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x0, 0x0, 0x200008910, 0x200008920, 0x200008940,
+0x0, 0x2, 0x800008950, 0x1BB3, 0x1BF5, 0x1BC7, 0x1BF5, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200008970, 0x0, 0x0,
+0x0, 0x2000089B0, 0x100000024, 0x1, 0x6000089B8, 0x1BF5, 0x1C21, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1C0B, 0x1C17, 0x1C1C, 0x1C20, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1000089C8,
+0x1000089F0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x900008A10, 0x1C21,
+0x1C5F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1C36, 0x1C53, 0x1C58, 0x1C5E, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x200008A38, 0x100008A80, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x900008AA0, 0x1C5F, 0x1C8C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1C74, 0x1C80, 0x1C85,
+0x1C8B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100008AB8, 0x100008AE0, 0x0, 0x0, 0x0,
+0x0, 0x1, 0x700008B00, 0x1C8C, 0x1CC5, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1CA1,
+0x1CB9, 0x1CBE, 0x1CC4, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200008B18, 0x100008B60, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x700008B80, 0x1CC5, 0x1CFE, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1CDA, 0x1CF2, 0x1CF7, 0x1CFD, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200008B98,
+0x100008BE0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x800008C00, 0x1CFE,
+0x1D47, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1D13, 0x1D3B, 0x1D40, 0x1D46, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x300008C20, 0x100008C88, 0x0, 0x0, 0x0, 0x0, 0x1,
+0x800008CA8, 0x1D47, 0x1D80, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1D5C, 0x1D74, 0x1D79,
+0x1D7F, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200008CC0, 0x100008D08, 0x0, 0x0, 0x0,
+0x0, 0x1, 0xA00008D28, 0x1D80, 0x1DAD, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1D95,
+0x1DA1, 0x1DA6, 0x1DAC, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100008D40, 0x100008D68, 0x0,
+0x0, 0x0, 0x0, 0x100000001, 0xB00008D88, 0x1DAD, 0x1DF4, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1DC2, 0x1DCE, 0x1DD4, 0x1DF2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100008DA0,
+0x200008DD0, 0x0, 0x0, 0x0, 0x0, 0x100000001, 0xA00008E10, 0x1DF4,
+0x1E43, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1E09, 0x1E15, 0x1E1B, 0x1E41, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x100008E28, 0x200008E58, 0x0, 0x0, 0x0, 0x0, 0x100000001,
+0xE00008E98, 0x1E43, 0x1E90, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1E5D, 0x1E69, 0x1E6F,
+0x1E8E, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100008EB0, 0x200008EE0, 0x0, 0x0, 0x0,
+0x0, 0x1, 0xF00008F20, 0x1E90, 0x1ED2, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1EA9,
+0x1EC6, 0x1ECB, 0x1ED1, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200008F40, 0x100008F88, 0x0,
+0x0, 0x0, 0x0, 0x1, 0x1000008FA8, 0x1ED2, 0x1F02, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x1EF6, 0x1EF6, 0x1EFB, 0x1F01, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x8FB8,
+0x100008FC0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1000008FE0, 0x1F02,
+0x1F28, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x1F1C, 0x1F1C, 0x1F21, 0x1F27, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x8FF0, 0x100008FF8, 0x0, 0x0, 0x0, 0x0, 0x979,
+0x9AC, 0x9AD, 0x9D2, 0x9D3, 0x9FB, 0x9FC, 0xA24, 0xA25,
+0xA4B, 0xA4C, 0xA78, 0xA79, 0xAA6, 0xAA7, 0xACE, 0xACF,
+0xAF5, 0xAF6, 0xB1C, 0xB1D, 0xB43, 0xB44, 0xB6A, 0xB6B,
+0xB91, 0xB92, 0xBB8, 0xBB9, 0xBDF, 0xBE0, 0xC06, 0xC07,
+0xC2E, 0xC2F, 0xC55, 0xC56, 0xC7C, 0xC7D, 0xCA3, 0xCA4,
+0xCCA, 0xCCB, 0xCF1, 0xCF2, 0xD18, 0xD19, 0xD3F, 0xD40,
+0xD65, 0x766F79, 0x736F, 0x747865746E6F63, 0x736C6C6163, 0x454C435F49534E41, 0x5241, 0x4D4F485F49534E41,
+0x45, 0x4449485F49534E41, 0x524F535255435F45, 0x4F48535F49534E41, 0x524F535255435F57, 0x5345525F49534E41, 0x5445, 0x544C415F49534E41,
+0x5F5245464655425F, 0x4E4F, 0x544C415F49534E41, 0x5F5245464655425F, 0x46464F, 0x5F47465F49534E41, 0x4B43414C42, 0x5F47465F49534E41,
+0x444552, 0x5F47465F49534E41, 0x4E45455247, 0x5F47465F49534E41, 0x574F4C4C4559, 0x5F47465F49534E41, 0x45554C42, 0x5F47465F49534E41,
+0x41544E4547414D, 0x5F47465F49534E41, 0x4E415943, 0x5F47465F49534E41, 0x4554494857, 0x5F47465F49534E41, 0x59415247, 0x5F47425F49534E41,
+0x4B43414C42, 0x5F47425F49534E41, 0x444552, 0x5F47425F49534E41, 0x4E45455247, 0x5F47425F49534E41, 0x574F4C4C4559, 0x5F47425F49534E41,
+0x45554C42, 0x5F47425F49534E41, 0x41544E4547414D, 0x5F47425F49534E41, 0x4E415943, 0x5F47425F49534E41, 0x4554494857, 0x5845545F49534E41,
+0x444C4F425F54, 0x30000C8C8, 0x100000019, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x20000C8D0, 0x10000001A, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x70000C8D8, 0x10000001B, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x50000C8E0, 0x10000001C, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xA0000C8E8, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x90000C8F8, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x100000C908, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x100000C918, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xA0000C928, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x120000C938, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0x130000C950, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xD0000C968, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xB0000C978, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xD0000C988, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xE0000C998, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xC0000C9A8, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xF0000C9B8, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xC0000C9C8, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xD0000C9D8, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xC0000C9E8, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xD0000C9F8, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xB0000CA08, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xD0000CA18, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xE0000CA28, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xC0000CA38, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xF0000CA48, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xC0000CA58, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xD0000CA68, 0x100000001, 0xFFFFFFFFFFFFFFFF,
+0xFFFFFFFFFFFFFFFF, 0xE0000CA78, 0x100000001, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x200000003, 0x300000000, 0x4,
+0x3, 0x300000000, 0x1, 0x400000003, 0x400000007, 0x700000002, 0x400000005, 0x500000000,
+0x6, 0x2, 0x400000000, 0x2, 0x4, 0x300000000, 0x3, 0x100000003,
+0x400000007, 0x23, 0x3600000004, 0x400000006, 0x36, 0x4A00000004, 0x300000007, 0x700000000,
+0x4B00000004, 0x400000007, 0x70000004C, 0x4D00000004, 0x400000007, 0x4E, 0x5200000005, 0x400000000,
+0x53, 0x5300000004, 0x400000007, 0x1, 0x500000004, 0x400000000, 0x3, 0x700000004,
+0x0
+};
@@ -3,12 +3,19 @@ const char* YOV_HELP_STR = ""
 "yov [language options] script_to_execute [script arguments]\n"
 "\n"
 "Language options:\n"
-"    -analyze          analyzes the script without executing it.\n"
+"    -analyze          analyzes the script without executing it. Every function is compiled, including\n"
+"                      the ones that are never called.\n"
 "    -trace            prints each line of code as it executes (for debugging/tracing purposes).\n"
 "    -wait_end         displays a completion message and waits for the user to press ENTER before exiting.\n"
 "    -user_assert      prompts the user for confirmation before performing any OS-level operation\n"
 "                      (e.g. deleting a file).\n"
 "    -no_user          disable all user prompts, automatically answer 'Yes' to all confirmations.\n"
+"    -threads=N        number of threads used to compile the script. By default it depends on the\n"
+"                      size of the script and its imports.\n"
+"    -cache=DIR        stores the compiled program in DIR and reuses it while the scripts, the script\n"
+"                      arguments and the version of Yov are unchanged.\n"
+"    -core_image=PATH  compiles core.yov and writes the image embedded in the executable to a C++ header.\n"
+"                      Used by the build, no script is executed.\n"
 "\n"
 "Info options:\n"
 "    -version, -v      displays the current version of Yov.\n"
@@ -8,7 +8,7 @@
 // DEBUG
 
 #define DEV_ASAN DEV && 0
-#define DEV_UNSORTED_REPORTS DEV && 0
+#define DEV_UNSORTED_REPORTS (DEV && 0)
 
 #define LOG_FLOW_ENABLED   DEV && 0
 #define LOG_TYPE_ENABLED   DEV && 0
@@ -148,6 +148,21 @@ typedef volatile U32 Mutex;
 #else
 #endif
 
+#if defined(_M_X64) || defined(__x86_64__)
+#define SIMD_SSE2 1
+#include <emmintrin.h>
+#else
+#define SIMD_SSE2 0
+#endif
+
+// NOTE(Jose): AVX2 paths are compile time only, enabled by building with /arch:AVX2
+#if SIMD_SSE2 && defined(__AVX2__)
+#define SIMD_AVX2 1
+#include <immintrin.h>
+#else
+#define SIMD_AVX2 0
+#endif
+
 #if OS_WINDOWS
 #pragma section(".rdonly", read)
 #define read_only no_asan __declspec(allocate(".rdonly"))
@@ -167,6 +182,16 @@ typedef volatile U32 Mutex;
 
 #define foreach(it, count) for (U32 (it) = 0; (it) < (count); (it)++)
 
+#if COMPILER_MSVC
+inline_fn U32 CountTrailingZeros32(U32 v) { unsigned long index; _BitScanForward(&index, v); return (U32)index; }
+inline_fn U32 CountLeadingZeros32(U32 v) { unsigned long index; _BitScanReverse(&index, v); return 31 - (U32)index; }
+inline_fn U32 CountLeadingZeros64(U64 v) { unsigned long index; _BitScanReverse64(&index, v); return 63 - (U32)index; }
+#else
+inline_fn U32 CountTrailingZeros32(U32 v) { return (U32)__builtin_ctz(v); }
+inline_fn U32 CountLeadingZeros32(U32 v) { return (U32)__builtin_clz(v); }
+inline_fn U32 CountLeadingZeros64(U64 v) { return (U32)__builtin_clzll(v); }
+#endif
+
 #if DEV
 #define Assert(x) do { if ((x) == 0) AssertionFailed(#x, __FILE__, __LINE__); } while (0)
 #define InvalidCodepath() AssertionFailed("Invalid Codepath", __FILE__, __LINE__);
@@ -195,6 +220,7 @@ _defer<F> _defer_func(F f) {
 void AssertionFailed(const char* text, const char* file, U32 line);
 
 #define MemoryCopy(dst, src, size) memcpy(dst, src, size)
+#define MemoryMove(dst, src, size) memmove(dst, src, size)
 #define MemoryZero(dst, size) memset(dst, 0, size)
 
 #define _MACRO_STR(x) #x
@@ -206,9 +232,12 @@ U32 CStrSize(const char* str);
 U32 CStrSet(char* dst, const char* src, U32 src_size, U32 buff_size);
 U32 CStrCopy(char* dst, const char* src, U32 buff_size);
 U32 CStrAppend(char* dst, const char* src, U32 buff_size);
-void CStrFromU64(char* dst, U64 value, U32 base = 10);
-void CStrFromI64(char* dst, I64 value, U32 base = 10);
-void CStrFromF64(char* dst, F64 value, U32 decimals);
+// NOTE(Jose): Prints the shortest decimal representation that parses back to the same value
+#define F64_DECIMALS_SHORTEST U32_MAX
+
+U32 CStrFromU64(char* dst, U64 value, U32 base = 10);
+U32 CStrFromI64(char* dst, I64 value, U32 base = 10);
+U32 CStrFromF64(char* dst, F64 value, U32 decimals = F64_DECIMALS_SHORTEST);
 
 //- BASE STRUCTS
 
@@ -461,49 +490,68 @@ U32 _AtomicStore32(volatile U32* dst, U32 src);
 
 //- MULTITHREADING 
 
-struct LaneContext;
-typedef void LaneFn(LaneContext* lane);
+// NOTE(Jose): Persistent pool of workers, the thread that starts the pool works as the worker 0.
+// Each worker owns a deque, the owner pushes and pops from the bottom and the idle workers steal from the top.
+// Workers without work park on their own semaphore instead of spinning.
+// TaskPoolStart can be called again to grow the pool, only when no task is running
 
-struct LaneGroup {
-    Arena* arena;
-    Array<OS_Thread> threads;
-    LaneFn* fn;
+typedef void TaskFn(void* user_data, U32 index);
+typedef void TaskRangeFn(void* user_data, RangeU32 range);
+
+struct TaskGroup {
+    volatile U32 pending;
+};
+
+struct Task {
+    TaskFn* fn;
     void* user_data;
-    
-    volatile U32 barrier_counter; // Used on "lane_barrier()"
-    
-    union {
-        void* ptr;
-    } sync;
-    
-    // Non-Uniform task distrubution
-    volatile U32 task_next;
-    volatile U32 task_total;
-    volatile U32 task_finished; // For dynamic tasks
+    TaskGroup* group;
+    U32 index;
 };
 
-struct LaneContext {
-    LaneGroup* group;
-    U32 id;
-    U32 count;
+#define TASK_WORKER_MAX 256
+#define TASK_DEQUE_CAPACITY 4096
+#define TASK_SPIN_COUNT 64
+#define TASK_CHUNKS_PER_WORKER 4
+
+struct TaskDeque {
+    volatile U32 top;
+    volatile U32 bottom;
+    Task* tasks;
 };
 
-LaneGroup* LaneGroupStart(Arena* arena, LaneFn* fn, void* user_data, U32 lane_count = U32_MAX);
-void LaneGroupWait(LaneGroup* group);
+struct TaskWorker {
+    TaskDeque deque;
+    OS_Thread thread;
+    OS_Semaphore semaphore;
+    volatile U32 parked;
+    volatile U32 waiting;
+    U32 scratch_generation;
+};
 
-void LaneBarrier(LaneContext* lane);
-B32 LaneNarrow(LaneContext* lane, U32 index = 0);
+struct TaskPool {
+    Arena* arena;
+    TaskWorker* workers;
+    volatile U32 worker_count;
+    
+    volatile U32 queued;
+    volatile U32 waiters;
+    volatile U32 scratch_generation;
+    volatile U32 shutdown;
+};
 
-void LaneSyncPtr(LaneContext* lane, void** ptr, U32 index);
+extern TaskPool task_pool;
 
-RangeU32 LaneDistributeUniformWork(LaneContext* lane, U32 count);
+void TaskPoolStart(U32 worker_count);
+void TaskPoolShutdown();
+void TaskPoolResetScratch();
 
-void LaneTaskStart(LaneContext* lane, U32 count);
-void LaneTaskAdd(LaneGroup* group, U32 count);
-B32 LaneTaskFetch(LaneGroup* group, U32* index);
+void TaskGroupPush(TaskGroup* group, TaskFn* fn, void* user_data, U32 index);
+void TaskGroupJoin(TaskGroup* group);
+void TaskPoolWaitValue(volatile U32* value, U32 expected); // Runs tasks until the value is reached, parking when there are none
+B32 TaskPoolRunOne();
 
-B32 LaneDynamicTaskIsBusy(LaneGroup* group);
-void LaneDynamicTaskFinish(LaneGroup* group);
+void TaskParallelFor(TaskRangeFn* fn, void* user_data, U32 count);
 
 B32 MutexTryLock(Mutex* mutex);
 void MutexLock(Mutex* mutex);
@@ -531,6 +579,7 @@ String StrHeapCopy(String src);
 void StrHeapFree(String* str);
 String StrSub(String str, U64 offset, U64 size);
 B32 StrEquals(String s0, String s1);
+I32 StrCompare(String s0, String s1);
 B32 StrStarts(String str, String with);
 B32 StrEnds(String str, String with);
 B32 U32FromString(U32* dst, String str, U32 base = 10);
@@ -541,16 +590,23 @@ B32 I64FromString(I64* out, String str);
 B32 I32FromString(I32* out, String str);
 String StrFromU64(Arena* arena, U64 value, U32 base = 10);
 String StrFromI64(Arena* arena, I64 value, U32 base = 10);
-String StrFromF64(Arena* arena, F64 value, U32 decimals);
+String StrFromF64(Arena* arena, F64 value, U32 decimals = F64_DECIMALS_SHORTEST);
 String StringFromCodepoint(Arena* arena, U32 codepoint);
 String StringFromMemory(U64 bytes);
 String StringFromEllapsedTime(F64 seconds);
 String StrJoin(Arena* arena, LinkedList<String> ll);
+U64 StrFind(String str, String pattern, U64 cursor = 0);
+U64 StrFindLast(String str, String pattern);
+U64 StrCount(String str, String pattern);
+B32 StrContains(String str, String pattern);
 Array<String> StrSplit(Arena* arena, String str, String separator);
 String StrReplace(Arena* arena, String str, String old_str, String new_str);
 String string_format_with_args(Arena* arena, String string, va_list args);
 String string_format_ex(Arena* arena, String string, ...);
 U32 StrGetCodepoint(String str, U64* cursor_ptr);
+U64 StrSkipAscii(String str, U64 cursor);
+U64 StrFindByte(String str, U64 cursor, U8 byte);
+B32 StrIsValidUtf8(String str);
 U32 StrCalculateCharCount(String str);
 String escape_string_from_raw_string(Arena* arena, String raw);
 
@@ -566,6 +622,15 @@ B32 CodepointIsText(U32 codepoint);
 
 #define StrFormat(arena, str, ...) string_format_ex(arena, str, __VA_ARGS__)
 
+//- INTERN
+
+// NOTE(Jose): Process wide string table shared by every thread, used to compare identifiers by ID.
+// Lookups are lock free, only the insertion of a new string takes the lock. The ID 0 is never assigned.
+
+U32 InternString(String str);
+U32 InternFind(String str);
+String StringFromIntern(U32 id);
+
 //- PATH
 
 Array<String> PathSubdivide(Arena* arena, String path);
@@ -585,12 +650,29 @@ void append_i64(StringBuilder* builder, I64 v, U32 base = 10);
 void append_i32(StringBuilder* builder, I32 v, U32 base = 10);
 void append_u64(StringBuilder* builder, U64 v, U32 base = 10);
 void append_u32(StringBuilder* builder, U32 v, U32 base = 10);
-void append_f64(StringBuilder* builder, F64 v, U32 decimals);
+void append_f64(StringBuilder* builder, F64 v, U32 decimals = F64_DECIMALS_SHORTEST);
 void append_char(StringBuilder* builder, char c);
 String string_from_builder(Arena* arena, StringBuilder* builder);
 
 #define appendf(builder, str, ...) appendf_ex(builder, str, __VA_ARGS__)
 
+//- SORT
+
+struct SortKeyU64 {
+    U64 key;
+    U32 index;
+};
+
+struct SortKeyStr {
+    String key;
+    U32 index;
+};
+
+U64 SortKeyFromI64(I64 v);
+U64 SortKeyFromF64(F64 v);
+void SortRadix(Arena* arena, Array<SortKeyU64> keys);
+void SortStrings(Array<SortKeyStr> keys, B32 stable);
+
 //- BUCKET BUFFER
 
 struct BBufferBlock
@@ -600,6 +682,11 @@ struct BBufferBlock
     U32 count;
 };
 
+#define BBUFFER_MAX_BLOCKS 32
+
+// NOTE(Jose): Each block doubles the capacity of the previous one, the block of an index is found with a bit scan.
+// Blocks are never moved, the addresses returned by BBufferAdd are stable
+
 struct BBuffer
 {
     Arena* arena;
@@ -608,6 +695,10 @@ struct BBuffer
     BBufferBlock* current;
     U64 stride;
     
+    BBufferBlock* blocks[BBUFFER_MAX_BLOCKS];
+    U32 block_count;
+    U32 capacity_shift;
+    
     U32 default_block_capacity;
     U32 count;
 };
@@ -619,6 +710,22 @@ void BBufferErase(BBuffer* buffer, U32 index);
 void BBufferPop(BBuffer* buffer);
 U32 BBufferCalculateIndex(BBuffer* buffer, void* ptr);
 
+inline_fn U32 BBufferBlockFromIndex(BBuffer* buffer, U32 index, U32* block_offset)
+{
+    U32 block_index = 31 - CountLeadingZeros32((index >> buffer->capacity_shift) + 1);
+    *block_offset = index - (((1u << block_index) - 1) << buffer->capacity_shift);
+    return block_index;
+}
+
+inline_fn void* BBufferGet(BBuffer* buffer, U32 index)
+{
+    Assert(index < buffer->count);
+    
+    U32 offset;
+    BBufferBlock* block = buffer->blocks[BBufferBlockFromIndex(buffer, index, &offset)];
+    return (U8*)(block + 1) + offset * buffer->stride;
+}
+
 #include "templates.h"
 
 //- LOCATION
@@ -725,11 +832,13 @@ struct YovSettings {
     B8 user_assert;
     B8 wait_end;
     B8 no_user;
+    U32 threads; // 0 picks the count from the input size
 };
 
 struct YovThreadContext {
     Arena* arena;
     U32 thread_index;
+    U32 worker_index;
 };
 
 struct YovSystemInfo {
@@ -765,6 +874,7 @@ struct Reporter {
 Reporter* ReporterAlloc(Arena* arena);
 void ReportErrorEx(Reporter* reporter, Location location, U32 line, String path, String text, ...);
 void ReporterSetExitCode(Reporter* reporter, I64 exit_code);
+void ReporterMerge(Reporter* dst, Reporter* src);
 void ReporterPrint(Reporter* reporter);
 String StringFromReport(Arena* arena, Report report);
 void PrintReport(Report report);
@@ -774,9 +884,14 @@ void PrintReport(Report report);
 #define LANG_ARG_USER_ASSERT STR("-user_assert")
 #define LANG_ARG_WAIT_END STR("-wait_end")
 #define LANG_ARG_NO_USER STR("-no_user")
+#define LANG_ARG_THREADS STR("-threads")
+#define LANG_ARG_CORE_IMAGE STR("-core_image")
+#define LANG_ARG_CACHE STR("-cache")
 
 struct Input {
     String main_script_path;
+    String core_image_path; // Only compiles core.yov and writes its image
+    String cache_dir;
     String caller_dir;
     YovSettings settings;
     Array<ScriptArg> script_args;
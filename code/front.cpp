@@ -1,46 +1,85 @@
 #include "front.h"
 
-internal_fn void FrontRun(FrontContext* front, LaneContext* lane)
+internal_fn void FrontResolveReportInfo(FrontContext* front, Reporter* reporter, Report* report)
+{
+    Location location = report->location;
+    YovScript* script = FrontGetScript(front, location.script_id);
+    if (script == NULL) return;
+    
+    report->path = StrCopy(reporter->arena, script->path);
+    report->line = LineFromLocation(location, script);
+}
+
+internal_fn void FrontResolveReportsInfo(void* user_data, RangeU32 range)
+{
+    FrontContext* front = (FrontContext*)user_data;
+    Reporter* reporter = front->reporter;
+    
+    for (U32 i = range.min; i < range.max; i++) {
+        FrontResolveReportInfo(front, reporter, &reporter->reports[i]);
+    }
+}
+
+// NOTE(Jose): Estimated cost of the passes after the import pass, measured in a release build.
+// Each extra worker costs a thread, its arena and the wake-ups of every pass, so it needs enough work to pay off
+#define FRONT_COST_PER_BYTE_NS 300
+#define FRONT_COST_PER_DEFINITION_NS 2000
+#define FRONT_COST_PER_WORKER_NS 4000000
+
+internal_fn U32 FrontWorkerCount(FrontContext* front)
+{
+    if (front->input->settings.threads > 0) {
+        return front->input->settings.threads;
+    }
+    
+    U64 bytes = 0;
+    foreach_BArray(it, &front->scripts) bytes += it.value->text.size;
+    
+    U64 definition_count = front->definitions.count;
+    U64 cost = bytes * FRONT_COST_PER_BYTE_NS + definition_count * FRONT_COST_PER_DEFINITION_NS;
+    
+    U64 worker_count = cost / FRONT_COST_PER_WORKER_NS;
+    worker_count = Min(worker_count, definition_count);
+    worker_count = Min(worker_count, (U64)system_info.logical_cores);
+    return (U32)Max(worker_count, 1);
+}
+
+internal_fn void FrontRun(FrontContext* front)
 {
     PROFILE_FUNCTION;
     
     {
-        if (LaneNarrow(lane)) {
-            LogFlow("Starting Read Locations & Imports Pass");
-        }
+        LogFlow("Starting Read Locations & Imports Pass");
         
         F64 start_time = TimerNow();
         
-        FrontReadAllScripts(lane, front);
-        ArenaPopTo(context.arena, 0);
+        FrontReadAllScripts(front);
+        TaskPoolResetScratch();
         
         if (front->reporter->exit_requested) {
             return;
         }
         
-        if (LaneNarrow(lane)) {
-            F64 ellapsed = TimerNow() - start_time;
-            LogFlow("Read locations & imports finished: %S", StringFromEllapsedTime(ellapsed));
-        }
+        F64 ellapsed = TimerNow() - start_time;
+        LogFlow("Read locations & imports finished: %S", StringFromEllapsedTime(ellapsed));
+        
+        // NOTE(Jose): The import pass runs on the calling thread, the rest of the passes only start workers if the input is big enough
+        TaskPoolStart(FrontWorkerCount(front));
+        LogFlow("Front workers: %u", task_pool.worker_count);
     }
     
     // Identify Pass
     {
-        if (LaneNarrow(lane)) {
-            LogFlow("Starting Identify Pass");
-        }
+        LogFlow("Starting Identify Pass");
         
         F64 start_time = TimerNow();
         
-        FrontIdentifyDefinitions(lane, front);
+        FrontIdentifyDefinitions(front);
         
-        if (LaneNarrow(lane)) {
-            F64 ellapsed = TimerNow() - start_time;
-            LogFlow("Identify pass finished: %S", StringFromEllapsedTime(ellapsed));
-        }
+        F64 ellapsed = TimerNow() - start_time;
+        LogFlow("Identify pass finished: %S", StringFromEllapsedTime(ellapsed));
         
-        ArenaPopTo(context.arena, 0);
-        LaneBarrier(lane);
+        TaskPoolResetScratch();
         
         if (front->reporter->exit_requested) {
             return;
@@ -49,22 +88,17 @@ internal_fn void FrontRun(FrontContext* front, LaneContext* lane)
     
     // Define Pass
     {
-        if (LaneNarrow(lane)) {
-            LogFlow("Starting Define Pass");
-        }
+        LogFlow("Starting Define Pass");
         
         F64 start_time = TimerNow();
         
-        FrontDefineDefinitions(lane, front);
-        FrontDefineGlobals(lane, front);
+        FrontDefineDefinitions(front);
+        FrontDefineGlobals(front);
         
-        ArenaPopTo(context.arena, 0);
-        LaneBarrier(lane);
+        TaskPoolResetScratch();
         
-        if (LaneNarrow(lane)) {
-            F64 ellapsed = TimerNow() - start_time;
-            LogFlow("Define pass finished: %S", StringFromEllapsedTime(ellapsed));
-        }
+        F64 ellapsed = TimerNow() - start_time;
+        LogFlow("Define pass finished: %S", StringFromEllapsedTime(ellapsed));
         
         if (front->reporter->exit_requested) {
             return;
@@ -73,52 +107,47 @@ internal_fn void FrontRun(FrontContext* front, LaneContext* lane)
     
     // Resolve Pass
     {
-        if (LaneNarrow(lane)) {
-            LogFlow("Starting Resolve Pass");
-        }
+        LogFlow("Starting Resolve Pass");
         
         F64 start_time = TimerNow();
         
-        FrontResolveDefinitions(lane, front);
-        FrontResolveGlobals(lane, front);
+        FrontResolveDefinitions(front);
+        FrontResolveGlobals(front);
         
-        ArenaPopTo(context.arena, 0);
-        LaneBarrier(lane);
+        TaskPoolResetScratch();
         
-        if (LaneNarrow(lane)) {
-            F64 ellapsed = TimerNow() - start_time;
-            LogFlow("Resolve pass finished: %S", StringFromEllapsedTime(ellapsed));
-        }
+        F64 ellapsed = TimerNow() - start_time;
+        LogFlow("Resolve pass finished: %S", StringFromEllapsedTime(ellapsed));
         
         if (front->reporter->exit_requested) {
             return;
         }
     }
-}
-
-internal_fn void FrontWide(LaneContext* lane)
-{
-    PROFILE_FUNCTION;
-    FrontContext* front = (FrontContext*)lane->group->user_data;
     
-    FrontRun(front, lane);
+    // Types listed in context.types, taken before the background compilation so the list doesn't depend on how far it got
+    {
+        Program* program = front->program;
+        MutexLockGuard(&program->types_mutex);
+        program->front_type_count = program->types.count;
+    }
     
-    // Resolve reports info
+    // NOTE(Jose): Function bodies compile in the background while the program runs, starting from Main and the global initializers.
+    // Their reports are kept apart until the runtime calls a body that failed or the compilation finishes, so they never stop the program at a random point
+    if (!front->resolve_all)
     {
-        Reporter* reporter = front->reporter;
+        LogFlow("Starting Background Compilation");
         
-        RangeU32 range = LaneDistributeUniformWork(lane, reporter->reports.count);
-        for (U32 i = range.min; i < range.max; i++)
-        {
-            Report* report = &reporter->reports[i];
-            
-            Location location = report->location;
-            YovScript* script = FrontGetScript(front, location.script_id);
-            if (script == NULL) continue;
-            
-            report->path = StrCopy(reporter->arena, script->path);
-            report->line = LineFromLocation(location, script);
+        Program* program = front->program;
+        
+        front->body_reporter = ReporterAlloc(front->arena);
+        
+        FunctionDefinition* main_function = FunctionFromIdentifier(program, "Main");
+        if (main_function != NULL) {
+            FrontRequestCode(front, IndexFromDefinition(program, main_function));
         }
+        FrontRequestCalls(front, program->globals_initialize_ir);
+        
+        program->background = front;
     }
 }
 
@@ -137,6 +166,11 @@ Program* ProgramFromInput(Arena* arena, Input* input, Reporter* reporter)
         return program;
     }
     
+    if (input->cache_dir.size > 0 && ProgramReadCache(program, input)) {
+        LogFlow("Program read from the cache");
+        return program;
+    }
+    
     FrontContext* front = NULL;
     
     Arena* front_arena = ArenaAlloc(Gb(32), 8, "Arena Front");
@@ -150,12 +184,29 @@ Program* ProgramFromInput(Arena* arena, Input* input, Reporter* reporter)
     front->global_location_list = BArrayMake<Location>(front_arena, 32);
     front->global_list = BArrayMake<Global>(front_arena, 32);
     front->global_initialize_group = IRFromNone();
+    front->resolve_all = input->settings.analyze_only;
+    front->body_reporter = reporter;
+    
+    program->background = NULL;
+    
+    TaskPoolStart(1);
     
-    LaneGroup* group = LaneGroupStart(context.arena, FrontWide, front);
-    LaneGroupWait(group);
+    FrontRun(front);
+    TaskParallelFor(FrontResolveReportsInfo, front, front->reporter->reports.count);
     
-    ArenaFree(front_arena);
-    ArenaPopTo(context.arena, 0);
+    if (input->core_image_path.size > 0 && !reporter->exit_requested) {
+        FrontWriteCoreImage(front, input->core_image_path);
+    }
+    
+    // With background compilation the cache is written once every requested body is compiled
+    if (input->cache_dir.size > 0 && program->background == NULL && !reporter->exit_requested) {
+        FrontWriteProgramCache(front);
+    }
+    
+    if (program->background == NULL) {
+        ArenaFree(front_arena);
+        TaskPoolResetScratch();
+    }
     
 #if LOG_IR_ENABLED
     PrintIr(program, "Initialize Globals", program->globals_initialize_ir);
@@ -163,6 +214,7 @@ Program* ProgramFromInput(Arena* arena, Input* input, Reporter* reporter)
     {
         DefinitionHeader* header = &program->definitions[i].header;
         FunctionDefinition* fn = &program->definitions[i].function;
+        if (header->type != DefinitionType_Function || header->stage != DefinitionStage_Ready) continue;
         if (fn->is_intrinsic) continue;
         PrintIr(program, fn->identifier, fn->defined.ir);
     }
@@ -171,6 +223,67 @@ Program* ProgramFromInput(Arena* arena, Input* input, Reporter* reporter)
     return program;
 }
 
+internal_fn void FrontJoinBackground(FrontContext* front)
+{
+    if (front->background_joined) return;
+    front->background_joined = true;
+    
+    TaskGroupJoin(&front->resolve_group);
+    
+    Reporter* body_reporter = front->body_reporter;
+    foreach(i, body_reporter->reports.count) {
+        FrontResolveReportInfo(front, body_reporter, &body_reporter->reports[i]);
+    }
+    ReporterMerge(front->reporter, body_reporter);
+}
+
+B32 ProgramWaitFunction(Program* program, FunctionDefinition* fn)
+{
+    if (fn->stage != DefinitionStage_Ready)
+    {
+        PROFILE_FUNCTION;
+        FrontContext* front = program->background;
+        
+        if (front == NULL) {
+            InvalidCodepath();
+            return false;
+        }
+        
+        // NOTE(Jose): Callees are requested before their caller is ready, so the body is queued or being compiled by another worker
+        FrontRequestCode(front, IndexFromDefinition(program, fn));
+        
+        TaskPoolWaitValue((volatile U32*)&fn->stage, DefinitionStage_Ready);
+        CompilerReadBarrier();
+    }
+    
+    if (fn->is_intrinsic || fn->defined.ir.success) return true;
+    
+    // Wait for the rest of the bodies, the reports don't depend on how far the compilation went
+    if (program->background != NULL) {
+        FrontJoinBackground(program->background);
+    }
+    return false;
+}
+
+void ProgramFinishCompilation(Program* program)
+{
+    PROFILE_FUNCTION;
+    
+    FrontContext* front = program->background;
+    if (front == NULL) return;
+    
+    FrontJoinBackground(front);
+    LogFlow("Background compilation finished");
+    
+    if (front->input->cache_dir.size > 0 && front->body_reporter->reports.count == 0) {
+        FrontWriteProgramCache(front);
+    }
+    
+    program->background = NULL;
+    ArenaFree(front->arena);
+    TaskPoolResetScratch();
+}
+
 internal_fn B32 ExpectAndSkipBraces(Parser* parser, Reporter* reporter)
 {
     Token open_brace_token = PeekToken(parser);
@@ -382,24 +495,1094 @@ YovScript* FrontAddScript(FrontContext* front, String path)
     return script;
 }
 
+#define IMAGE_HASH_SEED 14695981039346656037ull
+
+internal_fn U64 ImageHash(String text, U64 hash = IMAGE_HASH_SEED)
+{
+    foreach(i, text.size) {
+        hash ^= (U8)text.data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+template<typename T>
+internal_fn Array<T> ImageGetArray(void* image, ImageArray array)
+{
+    Array<T> res;
+    res.data = (T*)((U8*)image + array.offset);
+    res.count = array.count;
+    return res;
+}
+
+internal_fn String ImageGetString(void* image, ImageArray array)
+{
+    return StrMake((char*)image + array.offset, array.count);
+}
+
+internal_fn ImageArray ImagePush(Arena* image, const void* data, U64 stride, U32 count)
+{
+    U8* dst = (U8*)ArenaPush(image, stride * count);
+    if (count > 0) MemoryCopy(dst, data, stride * count);
+    
+    ImageArray array;
+    array.offset = (U32)(dst - (U8*)image->memory);
+    array.count = count;
+    return array;
+}
+
+internal_fn ImageArray ImagePushString(Arena* image, String str)
+{
+    return ImagePush(image, str.data, 1, (U32)str.size);
+}
+
+// NOTE(Jose): The image stores enum values and structs as they are in the executable that wrote it.
+// Adding an enum value or changing one of these structs invalidates the image even when core.yov didn't change
+internal_fn U64 CoreImageLayoutHash()
+{
+    U32 layout[] = {
+        TokenKind_BoolLiteral, VKind_List, DefinitionType_Arg, PrimitiveType_String,
+        sizeof(CoreImageHeader), sizeof(CoreImageDefinition), sizeof(CoreImageObject),
+        sizeof(CoreImageType), sizeof(CoreImageLocation), sizeof(ImageArray),
+    };
+    return ImageHash(StrMake((char*)layout, sizeof(layout)));
+}
+
 #include "autogenerated/core.h"
+#include "autogenerated/core_image.h"
+
+internal_fn CoreImageHeader* CoreImageFromExecutable(String core_text)
+{
+    CoreImageHeader* image = (CoreImageHeader*)YOV_CORE_IMAGE;
+    
+    // NOTE(Jose): The image of the previous build is compiled in until the new one is generated, it's ignored if core.yov or the layout changed
+    if (sizeof(YOV_CORE_IMAGE) < sizeof(CoreImageHeader)) return NULL;
+    if (image->magic != CORE_IMAGE_MAGIC || image->version != CORE_IMAGE_VERSION) return NULL;
+    if (image->size != sizeof(YOV_CORE_IMAGE)) return NULL;
+    if (image->layout_hash != CoreImageLayoutHash()) return NULL;
+    if (image->source_hash != ImageHash(core_text)) return NULL;
+    
+    return image;
+}
+
+internal_fn Location CoreImageGetLocation(FrontContext* front, CoreImageLocation location)
+{
+    if (location.min == U64_MAX) return NO_CODE;
+    return LocationMake(location.min, location.max, front->core_script_id);
+}
+
+// Tokens, lines and code definitions, the script is never read
+internal_fn void FrontReadCoreImage(FrontContext* front, YovScript* script)
+{
+    PROFILE_FUNCTION;
+    
+    CoreImageHeader* image = front->core_image;
+    
+    script->tokens.kinds = ImageGetArray<U8>(image, image->token_kinds).data;
+    script->tokens.starts = ImageGetArray<U32>(image, image->token_starts).data;
+    script->tokens.lengths = ImageGetArray<U32>(image, image->token_lengths).data;
+    script->tokens.matches = ImageGetArray<U32>(image, image->token_matches).data;
+    script->tokens.count = image->token_count;
+    script->tokens.range = { 0, script->text.size };
+    script->lines = ImageGetArray<U64>(image, image->lines);
+    
+    Array<CoreImageDefinition> definitions = ImageGetArray<CoreImageDefinition>(image, image->definitions);
+    
+    foreach(i, definitions.count)
+    {
+        CoreImageDefinition* src = &definitions[i];
+        
+        CodeDefinition def = {};
+        def.type = (DefinitionType)src->type;
+        def.identifier = ImageGetString(image, src->identifier);
+        def.index = i;
+        def.entire_location = CoreImageGetLocation(front, src->entire_location);
+        
+        if (def.type == DefinitionType_Function) {
+            def.function.body_location = CoreImageGetLocation(front, src->locations[0]);
+            def.function.parameters_location = CoreImageGetLocation(front, src->locations[1]);
+            def.function.returns_location = CoreImageGetLocation(front, src->locations[2]);
+            def.function.generics_location = CoreImageGetLocation(front, src->locations[3]);
+            def.function.return_is_list = src->return_is_list;
+            front->function_count++;
+        }
+        else if (def.type == DefinitionType_Struct) {
+            def.enum_or_struct.body_location = CoreImageGetLocation(front, src->locations[0]);
+            front->struct_count++;
+        }
+        else if (def.type == DefinitionType_Enum) {
+            def.enum_or_struct.body_location = CoreImageGetLocation(front, src->locations[0]);
+            front->enum_count++;
+        }
+        else {
+            InvalidCodepath();
+        }
+        
+        BArrayAdd(&front->definition_list, def);
+    }
+    
+    Array<CoreImageLocation> global_locations = ImageGetArray<CoreImageLocation>(image, image->global_locations);
+    
+    foreach(i, global_locations.count) {
+        BArrayAdd(&front->global_location_list, CoreImageGetLocation(front, global_locations[i]));
+    }
+    
+    front->core_definition_count = definitions.count;
+    front->core_global_location_count = global_locations.count;
+}
 
 YovScript* FrontAddCoreScript(FrontContext* front)
 {
     PROFILE_FUNCTION;
     String text = YOV_CORE;
     
-    MutexLockGuard(&front->mutex);
+    MutexLockGuard(&front->mutex);
+    
+    I32 script_id = front->scripts.count;
+    
+    YovScript* script = BArrayAdd(&front->scripts);
+    script->id = script_id;
+    script->path = "core.yov";
+    script->name = "core.yov";
+    script->dir = "./";
+    script->text = text;
+    
+    front->core_script_id = script_id;
+    
+    // NOTE(Jose): Writing the image needs core.yov compiled from the source
+    if (front->input->core_image_path.size == 0) {
+        front->core_image = CoreImageFromExecutable(text);
+    }
+    
+    if (front->core_image != NULL) {
+        FrontReadCoreImage(front, script);
+    }
+    
+    return script;
+}
+
+internal_fn Type* TypeFromCoreImage(Program* program, CoreImageType src)
+{
+    Type* type = nil_type;
+    
+    if (src.kind == VKind_Any) type = any_type;
+    else if (src.kind == VKind_Void) type = void_type;
+    else if (src.kind == VKind_Primitive) type = TypeFromPrimitive((PrimitiveType)src.index);
+    else if (src.kind == VKind_Struct) type = TypeFromStruct(program, StructFromIndex(program, src.index));
+    else if (src.kind == VKind_Enum) type = TypeFromEnum(program, EnumFromIndex(program, src.index));
+    
+    for (U32 derived = src.derived; derived != 0; derived >>= 8)
+    {
+        VKind kind = (VKind)(derived & 0xFF);
+        
+        if (kind == VKind_Array) type = TypeFromArray(program, type, 1);
+        else if (kind == VKind_List) type = TypeFromList(program, type, 1);
+        else if (kind == VKind_Reference) type = TypeFromReference(program, type);
+        else InvalidCodepath();
+    }
+    
+    return type;
+}
+
+internal_fn Array<ObjectDefinition> ObjectsFromCoreImage(FrontContext* front, Array<Type*> types, ImageArray array)
+{
+    CoreImageHeader* image = front->core_image;
+    Array<CoreImageObject> src = ImageGetArray<CoreImageObject>(image, array);
+    Array<ObjectDefinition> objects = ArrayAlloc<ObjectDefinition>(context.arena, src.count);
+    
+    foreach(i, src.count)
+    {
+        Type* type = types[src[i].type];
+        String name = ImageGetString(image, src[i].name);
+        Location location = CoreImageGetLocation(front, src[i].location);
+        objects[i] = ObjDefMake(name, type, location, src[i].is_constant, ValueFromZero(type));
+    }
+    
+    return objects;
+}
+
+void FrontMapCoreImage(FrontContext* front)
+{
+    PROFILE_FUNCTION;
+    
+    Program* program = front->program;
+    CoreImageHeader* image = front->core_image;
+    
+    Array<CoreImageDefinition> definitions = ImageGetArray<CoreImageDefinition>(image, image->definitions);
+    Array<CoreImageType> image_types = ImageGetArray<CoreImageType>(image, image->types);
+    
+    // All of them are identified first, the types can point to any core definition
+    foreach(i, definitions.count) {
+        CodeDefinition* code = &front->definitions[i];
+        DefinitionIdentify(program, code->index, code->type, code->identifier, code->entire_location);
+    }
+    
+    Array<Type*> types = ArrayAlloc<Type*>(context.arena, image_types.count);
+    foreach(i, types.count) {
+        types[i] = TypeFromCoreImage(program, image_types[i]);
+    }
+    
+    foreach(i, definitions.count)
+    {
+        CoreImageDefinition* src = &definitions[i];
+        Definition* def = &program->definitions[i];
+        
+        if (src->type == DefinitionType_Enum)
+        {
+            Array<ImageArray> src_names = ImageGetArray<ImageArray>(image, src->names);
+            Array<CoreImageLocation> src_locations = ImageGetArray<CoreImageLocation>(image, src->expression_locations);
+            
+            Array<String> names = ArrayAlloc<String>(context.arena, src_names.count);
+            Array<Location> expression_locations = ArrayAlloc<Location>(context.arena, src_locations.count);
+            
+            foreach(j, names.count) names[j] = ImageGetString(image, src_names[j]);
+            foreach(j, expression_locations.count) expression_locations[j] = CoreImageGetLocation(front, src_locations[j]);
+            
+            EnumDefine(program, &def->_enum, names, expression_locations);
+            EnumResolve(program, &def->_enum, ImageGetArray<I64>(image, src->values));
+        }
+        else if (src->type == DefinitionType_Struct)
+        {
+            StructDefine(program, &def->_struct, ObjectsFromCoreImage(front, types, src->objects));
+            StructResolveLayout(program, &def->_struct, ImageGetArray<U32>(image, src->values), src->size, src->needs_internal_release);
+        }
+        else if (src->type == DefinitionType_Function)
+        {
+            Array<ObjectDefinition> parameters = ObjectsFromCoreImage(front, types, src->objects);
+            Array<ObjectDefinition> returns = ObjectsFromCoreImage(front, types, src->returns);
+            FunctionDefine(program, &def->function, parameters, returns);
+        }
+    }
+}
+
+struct CoreImageWriter {
+    Arena* arena; // Only holds the image, so the pushes are contiguous
+    BArray<Type*> types;
+};
+
+internal_fn CoreImageLocation CoreImageLocationFrom(Location location)
+{
+    CoreImageLocation res;
+    res.min = LocationIsValid(location) ? location.range.min : U64_MAX;
+    res.max = LocationIsValid(location) ? location.range.max : U64_MAX;
+    return res;
+}
+
+internal_fn U32 CoreImageTypeIndex(CoreImageWriter* writer, Type* type)
+{
+    foreach_BArray(it, &writer->types) {
+        if (*it.value == type) return it.index;
+    }
+    
+    BArrayAdd(&writer->types, type);
+    return writer->types.count - 1;
+}
+
+internal_fn ImageArray CoreImagePushObjects(CoreImageWriter* writer, Array<ObjectDefinition> objects)
+{
+    Array<CoreImageObject> dst = ArrayAlloc<CoreImageObject>(context.arena, objects.count);
+    
+    foreach(i, objects.count)
+    {
+        ObjectDefinition obj = objects[i];
+        dst[i].name = ImagePushString(writer->arena, obj.name);
+        dst[i].type = CoreImageTypeIndex(writer, obj.type);
+        dst[i].is_constant = obj.is_constant;
+        dst[i].location = CoreImageLocationFrom(obj.location);
+    }
+    
+    return ImagePush(writer->arena, dst.data, sizeof(CoreImageObject), dst.count);
+}
+
+internal_fn CoreImageType CoreImageTypeFrom(Program* program, Type* type)
+{
+    CoreImageType res = {};
+    
+    // The innermost derivation ends in the lowest bits, it's the first one applied when mapped
+    U32 depth = 0;
+    while (type->kind == VKind_Array || type->kind == VKind_List || type->kind == VKind_Reference)
+    {
+        Assert(depth < 4);
+        res.derived = (res.derived << 8) | (U32)type->kind;
+        type = TypeGetNext(program, type);
+        depth++;
+    }
+    
+    res.kind = type->kind;
+    if (type->kind == VKind_Primitive) res.index = type->primitive;
+    else if (type->kind == VKind_Struct) res.index = IndexFromDefinition(program, type->_struct);
+    else if (type->kind == VKind_Enum) res.index = IndexFromDefinition(program, type->_enum);
+    
+    return res;
+}
+
+void FrontWriteCoreImage(FrontContext* front, String path)
+{
+    PROFILE_FUNCTION;
+    
+    Program* program = front->program;
+    Reporter* reporter = front->reporter;
+    YovScript* script = FrontGetScript(front, front->core_script_id);
+    
+    if (front->scripts.count != 1 || script == NULL) {
+        ReportErrorFront(NO_CODE, "The core script can't import other scripts");
+        return;
+    }
+    
+    CoreImageWriter writer = {};
+    writer.arena = ArenaAlloc(Gb(1), 8, "Arena Core Image");
+    writer.types = BArrayMake<Type*>(context.arena, 64);
+    defer(ArenaFree(writer.arena));
+    
+    CoreImageHeader* header = ArenaPushStruct<CoreImageHeader>(writer.arena);
+    MemoryZero(header, sizeof(CoreImageHeader));
+    header->magic = CORE_IMAGE_MAGIC;
+    header->version = CORE_IMAGE_VERSION;
+    header->source_hash = ImageHash(script->text);
+    header->layout_hash = CoreImageLayoutHash();
+    
+    TokenArray tokens = script->tokens;
+    header->token_count = tokens.count;
+    header->token_kinds = ImagePush(writer.arena, tokens.kinds, sizeof(U8), tokens.count);
+    header->token_starts = ImagePush(writer.arena, tokens.starts, sizeof(U32), tokens.count);
+    header->token_lengths = ImagePush(writer.arena, tokens.lengths, sizeof(U32), tokens.count);
+    header->token_matches = ImagePush(writer.arena, tokens.matches, sizeof(U32), tokens.count);
+    header->lines = ImagePush(writer.arena, script->lines.data, sizeof(U64), script->lines.count);
+    
+    // Definitions in index order, the image keeps their indices
+    Array<CodeDefinition*> codes = ArrayAlloc<CodeDefinition*>(context.arena, program->definitions.count);
+    foreach(i, front->definitions.count) {
+        codes[front->definitions[i].index] = &front->definitions[i];
+    }
+    
+    Array<CoreImageDefinition> definitions = ArrayAlloc<CoreImageDefinition>(context.arena, codes.count);
+    
+    foreach(i, codes.count)
+    {
+        CodeDefinition* code = codes[i];
+        Definition* def = &program->definitions[i];
+        CoreImageDefinition* dst = &definitions[i];
+        MemoryZero(dst, sizeof(CoreImageDefinition));
+        
+        dst->type = code->type;
+        dst->identifier = ImagePushString(writer.arena, code->identifier);
+        dst->entire_location = CoreImageLocationFrom(code->entire_location);
+        foreach(j, countof(dst->locations)) dst->locations[j] = CoreImageLocationFrom(NO_CODE);
+        
+        if (code->type == DefinitionType_Function)
+        {
+            FunctionDefinition* fn = &def->function;
+            
+            dst->locations[0] = CoreImageLocationFrom(code->function.body_location);
+            dst->locations[1] = CoreImageLocationFrom(code->function.parameters_location);
+            dst->locations[2] = CoreImageLocationFrom(code->function.returns_location);
+            dst->locations[3] = CoreImageLocationFrom(code->function.generics_location);
+            dst->return_is_list = code->function.return_is_list;
+            dst->objects = CoreImagePushObjects(&writer, fn->parameters);
+            dst->returns = CoreImagePushObjects(&writer, fn->returns);
+        }
+        else if (code->type == DefinitionType_Struct)
+        {
+            StructDefinition* st = &def->_struct;
+            
+            Array<ObjectDefinition> members = ArrayAlloc<ObjectDefinition>(context.arena, st->names.count);
+            foreach(j, members.count) {
+                members[j] = ObjDefMake(st->names[j], st->types[j], NO_CODE, false, ValueFromZero(st->types[j]));
+            }
+            
+            dst->locations[0] = CoreImageLocationFrom(code->enum_or_struct.body_location);
+            dst->objects = CoreImagePushObjects(&writer, members);
+            dst->values = ImagePush(writer.arena, st->offsets.data, sizeof(U32), st->offsets.count);
+            dst->size = st->size;
+            dst->needs_internal_release = st->needs_internal_release;
+        }
+        else if (code->type == DefinitionType_Enum)
+        {
+            EnumDefinition* en = &def->_enum;
+            
+            Array<ImageArray> names = ArrayAlloc<ImageArray>(context.arena, en->names.count);
+            foreach(j, names.count) names[j] = ImagePushString(writer.arena, en->names[j]);
+            
+            Array<CoreImageLocation> expression_locations = ArrayAlloc<CoreImageLocation>(context.arena, en->expression_locations.count);
+            foreach(j, expression_locations.count) expression_locations[j] = CoreImageLocationFrom(en->expression_locations[j]);
+            
+            dst->locations[0] = CoreImageLocationFrom(code->enum_or_struct.body_location);
+            dst->names = ImagePush(writer.arena, names.data, sizeof(ImageArray), names.count);
+            dst->expression_locations = ImagePush(writer.arena, expression_locations.data, sizeof(CoreImageLocation), expression_locations.count);
+            dst->values = ImagePush(writer.arena, en->values.data, sizeof(I64), en->values.count);
+        }
+        else
+        {
+            ReportErrorFront(code->entire_location, "The core script can't define args");
+            return;
+        }
+    }
+    
+    header->definitions = ImagePush(writer.arena, definitions.data, sizeof(CoreImageDefinition), definitions.count);
+    
+    Array<CoreImageLocation> global_locations = ArrayAlloc<CoreImageLocation>(context.arena, front->global_location_list.count);
+    foreach(i, global_locations.count) {
+        global_locations[i] = CoreImageLocationFrom(front->global_location_list[i]);
+    }
+    header->global_locations = ImagePush(writer.arena, global_locations.data, sizeof(CoreImageLocation), global_locations.count);
+    
+    Array<ObjectDefinition> globals = ArrayAlloc<ObjectDefinition>(context.arena, program->globals.count);
+    foreach(i, globals.count) {
+        Global global = program->globals[i];
+        globals[i] = ObjDefMake(global.identifier, global.type, NO_CODE, global.is_constant, ValueFromZero(global.type));
+    }
+    header->globals = CoreImagePushObjects(&writer, globals);
+    
+    // Pushed last, the objects above can still add types
+    Array<CoreImageType> types = ArrayAlloc<CoreImageType>(context.arena, writer.types.count);
+    foreach(i, types.count) {
+        types[i] = CoreImageTypeFrom(program, writer.types[i]);
+    }
+    header->types = ImagePush(writer.arena, types.data, sizeof(CoreImageType), types.count);
+    
+    // Padded to 64-bit words, the image is embedded as an U64 array so it keeps the alignment
+    ArenaPush(writer.arena, 0);
+    U64 size = writer.arena->memory_position;
+    U64* words = (U64*)writer.arena->memory;
+    header->size = (U32)size;
+    
+    StringBuilder builder = string_builder_make(context.arena);
+    append(&builder, "// Generated with 'yov -core_image', core.yov compiled into the definitions mapped at startup\n");
+    append(&builder, "const U64 YOV_CORE_IMAGE[] = {\n");
+    
+    U64 word_count = size / sizeof(U64);
+    foreach(i, word_count)
+    {
+        append(&builder, "0x");
+        append_u64(&builder, words[i], 16);
+        
+        if (i + 1 == word_count) append(&builder, "\n");
+        else if ((i + 1) % 8 == 0) append(&builder, ",\n");
+        else append(&builder, ", ");
+    }
+    
+    append(&builder, "};\n");
+    
+    String text = string_from_builder(context.arena, &builder);
+    if (OsWriteEntireFile(path, { text.data, text.size }).failed) {
+        ReportErrorFront(NO_CODE, "Can't write the core image '%S'", path);
+    }
+}
+
+// NOTE(Jose): Units, values and types are stored with the enum values and record layouts of the executable that wrote them.
+// Changing any of them gives new keys, so older entries are never read
+internal_fn U64 ProgramCacheLayoutHash(U64 hash)
+{
+    U32 layout[] = {
+        UnitKind_Is, ValueKind_ZeroInit, OperatorKind_Is, RegisterKind_Global,
+        sizeof(ProgramCacheHeader), sizeof(ProgramCacheScript), sizeof(ProgramCacheType),
+        sizeof(ProgramCacheValue), sizeof(ProgramCacheUnit), sizeof(ProgramCacheRegister),
+        sizeof(ProgramCacheIR), sizeof(ProgramCacheObject), sizeof(ProgramCacheDefinition),
+    };
+    U64 core_layout = CoreImageLayoutHash();
+    hash = ImageHash(StrMake((char*)&core_layout, sizeof(core_layout)), hash);
+    return ImageHash(StrMake((char*)layout, sizeof(layout)), hash);
+}
+
+internal_fn U64 ProgramCacheKey(Input* input)
+{
+    U64 key = ImageHash(YOV_VERSION);
+    key = ImageHash(YOV_CORE, key);
+    key = ProgramCacheLayoutHash(key);
+#if DEV
+    key = ImageHash("DEV", key);
+#endif
+    key = ImageHash(input->main_script_path, key);
+    
+    // Analyze compiles every body, a lazy run only the ones it requests
+    if (input->settings.analyze_only) key = ImageHash("-analyze", key);
+    
+    // NOTE(Jose): Script args are stored by the global initializers
+    foreach(i, input->script_args.count) {
+        ScriptArg arg = input->script_args[i];
+        key = ImageHash("\n", key);
+        key = ImageHash(arg.name, key);
+        key = ImageHash("=", key);
+        key = ImageHash(arg.value, key);
+    }
+    
+    return key;
+}
+
+internal_fn String ProgramCachePath(Input* input, U64 key)
+{
+    StringBuilder builder = string_builder_make(context.arena);
+    append(&builder, input->cache_dir);
+    append(&builder, "/");
+    append_u64(&builder, key, 16);
+    append(&builder, ".yovc");
+    return string_from_builder(context.arena, &builder);
+}
+
+struct ProgramCacheWriter {
+    Arena* arena; // Only holds the cache, so the pushes are contiguous
+    Program* program;
+    Type* type_type;
+    Array<SortKeyU64> types; // Addresses of the program types, sorted
+    B32 failed;
+};
+
+internal_fn U32 ProgramCacheTypeIndex(ProgramCacheWriter* writer, Type* type)
+{
+    if (type == NULL) return 0;
+    if (type->kind == VKind_Nil) return 1;
+    if (type->kind == VKind_Void) return 2;
+    if (type->kind == VKind_Any) return 3;
+    if (type->kind == VKind_Primitive) return 4 + type->primitive;
+    
+    U32 min = 0;
+    U32 max = writer->types.count;
+    
+    while (min < max)
+    {
+        U32 mid = (min + max) / 2;
+        U64 key = writer->types[mid].key;
+        
+        if (key == (U64)type) return writer->types[mid].index;
+        if (key < (U64)type) min = mid + 1;
+        else max = mid;
+    }
+    
+    writer->failed = true;
+    return 0;
+}
+
+internal_fn ProgramCacheValue ProgramCacheValueFrom(ProgramCacheWriter* writer, Value value);
+
+internal_fn ImageArray ProgramCachePushValues(ProgramCacheWriter* writer, Array<Value> values)
+{
+    Array<ProgramCacheValue> dst = ArrayAlloc<ProgramCacheValue>(context.arena, values.count);
+    foreach(i, dst.count) {
+        dst[i] = ProgramCacheValueFrom(writer, values[i]);
+    }
+    return ImagePush(writer->arena, dst.data, sizeof(ProgramCacheValue), dst.count);
+}
+
+internal_fn ProgramCacheValue ProgramCacheValueFrom(ProgramCacheWriter* writer, Value value)
+{
+    ProgramCacheValue dst = {};
+    dst.kind = value.kind;
+    dst.type = ProgramCacheTypeIndex(writer, value.type);
+    
+    if (value.kind == ValueKind_Literal && value.type == string_type) {
+        dst.array = ImagePushString(writer->arena, value.literal_string);
+    }
+    else if (value.kind == ValueKind_Literal && value.type == writer->type_type) {
+        dst.data = ProgramCacheTypeIndex(writer, value.literal_type);
+    }
+    else if (value.kind == ValueKind_Array) {
+        dst.array = ProgramCachePushValues(writer, value.array.values);
+    }
+    else if (value.kind == ValueKind_StringComposition) {
+        dst.array = ProgramCachePushValues(writer, value.string_composition);
+    }
+    else if (value.kind == ValueKind_MultipleReturn) {
+        dst.array = ProgramCachePushValues(writer, value.multiple_return);
+    }
+    else {
+        dst.data = value.literal_uint;
+    }
+    
+    return dst;
+}
+
+internal_fn ProgramCacheIR ProgramCacheIRFrom(ProgramCacheWriter* writer, IR ir)
+{
+    Program* program = writer->program;
+    
+    ProgramCacheIR dst = {};
+    dst.success = ir.success;
+    dst.parameter_count = ir.parameter_count;
+    dst.value = ProgramCacheValueFrom(writer, ir.value);
+    dst.path = ImagePushString(writer->arena, ir.path);
+    
+    Array<ProgramCacheUnit> units = ArrayAlloc<ProgramCacheUnit>(context.arena, ir.instructions.count);
+    
+    foreach(i, units.count)
+    {
+        Unit unit = ir.instructions[i];
+        ProgramCacheUnit* unit_dst = &units[i];
+        MemoryZero(unit_dst, sizeof(ProgramCacheUnit));
+        
+        unit_dst->kind = unit.kind;
+        unit_dst->line = unit.line;
+        unit_dst->dst_index = unit.dst_index;
+        unit_dst->op_dst_type = unit.op_dst_type;
+        unit_dst->src0 = ProgramCacheValueFrom(writer, unit.src0);
+        unit_dst->src1 = ProgramCacheValueFrom(writer, unit.src1);
+        
+        if (unit.kind == UnitKind_FunctionCall) {
+            unit_dst->data[0] = (unit.function_call.fn != NULL) ? (I32)IndexFromDefinition(program, unit.function_call.fn) : -1;
+            unit_dst->parameters = ProgramCachePushValues(writer, unit.function_call.parameters);
+        }
+        else if (unit.kind == UnitKind_Jump) {
+            unit_dst->data[0] = unit.jump.condition;
+            unit_dst->data[1] = unit.jump.offset;
+        }
+        else if (unit.kind == UnitKind_Child) {
+            unit_dst->data[0] = unit.child.child_is_member;
+            unit_dst->data[1] = unit.child.child_is_write;
+        }
+    }
+    
+    dst.instructions = ImagePush(writer->arena, units.data, sizeof(ProgramCacheUnit), units.count);
+    
+    Array<ProgramCacheRegister> registers = ArrayAlloc<ProgramCacheRegister>(context.arena, ir.local_registers.count);
+    
+    foreach(i, registers.count) {
+        Register reg = ir.local_registers[i];
+        registers[i].kind = reg.kind;
+        registers[i].is_constant = reg.is_constant;
+        registers[i].type = ProgramCacheTypeIndex(writer, reg.type);
+    }
+    
+    dst.local_registers = ImagePush(writer->arena, registers.data, sizeof(ProgramCacheRegister), registers.count);
+    
+    return dst;
+}
+
+internal_fn ImageArray ProgramCachePushObjects(ProgramCacheWriter* writer, Array<ObjectDefinition> objects)
+{
+    Array<ProgramCacheObject> dst = ArrayAlloc<ProgramCacheObject>(context.arena, objects.count);
+    
+    foreach(i, objects.count)
+    {
+        ObjectDefinition obj = objects[i];
+        dst[i].name = ImagePushString(writer->arena, obj.name);
+        dst[i].type = ProgramCacheTypeIndex(writer, obj.type);
+        dst[i].is_constant = obj.is_constant;
+        dst[i].value = ProgramCacheValueFrom(writer, obj.value);
+    }
+    
+    return ImagePush(writer->arena, dst.data, sizeof(ProgramCacheObject), dst.count);
+}
+
+void FrontWriteProgramCache(FrontContext* front)
+{
+    PROFILE_FUNCTION;
+    
+    Program* program = front->program;
+    Input* input = front->input;
+    
+    // Functions never requested by the program are stored defined, any other definition must be ready
+    foreach(i, program->definitions.count) {
+        DefinitionHeader* def = &program->definitions[i].header;
+        if (def->stage == DefinitionStage_Ready) continue;
+        if (def->type == DefinitionType_Function && def->stage == DefinitionStage_Defined) continue;
+        return;
+    }
+    
+    ProgramCacheWriter writer = {};
+    writer.arena = ArenaAlloc(Gb(4), 8, "Arena Program Cache");
+    writer.program = program;
+    writer.type_type = Type_Type;
+    defer(ArenaFree(writer.arena));
+    
+    writer.types = ArrayAlloc<SortKeyU64>(context.arena, program->types.count);
+    foreach_BArray(it, &program->types) {
+        writer.types[it.index].key = (U64)it.value;
+        writer.types[it.index].index = PROGRAM_CACHE_BUILTIN_TYPES + it.index;
+    }
+    SortRadix(context.arena, writer.types);
+    
+    ProgramCacheHeader* header = ArenaPushStruct<ProgramCacheHeader>(writer.arena);
+    MemoryZero(header, sizeof(ProgramCacheHeader));
+    header->magic = PROGRAM_CACHE_MAGIC;
+    header->version = PROGRAM_CACHE_VERSION;
+    header->key = ProgramCacheKey(input);
+    
+    // Core is part of the key
+    BArray<ProgramCacheScript> scripts = BArrayMake<ProgramCacheScript>(context.arena, 16);
+    foreach_BArray(it, &front->scripts)
+    {
+        YovScript* script = it.value;
+        if (script->id == front->core_script_id) continue;
+        
+        ProgramCacheScript dst = {};
+        dst.path = ImagePushString(writer.arena, script->path);
+        dst.hash = ImageHash(script->text);
+        BArrayAdd(&scripts, dst);
+    }
+    
+    Array<ProgramCacheScript> script_array = ArrayFromBArray(context.arena, scripts);
+    header->scripts = ImagePush(writer.arena, script_array.data, sizeof(ProgramCacheScript), script_array.count);
+    
+    Array<ProgramCacheType> types = ArrayAlloc<ProgramCacheType>(context.arena, program->types.count);
+    
+    foreach_BArray(it, &program->types)
+    {
+        Type* type = it.value;
+        ProgramCacheType* dst = &types[it.index];
+        
+        dst->kind = type->kind;
+        if (type->kind == VKind_Struct) dst->index = IndexFromDefinition(program, type->_struct);
+        else if (type->kind == VKind_Enum) dst->index = IndexFromDefinition(program, type->_enum);
+        else dst->index = ProgramCacheTypeIndex(&writer, TypeGetNext(program, type));
+    }
+    
+    header->types = ImagePush(writer.arena, types.data, sizeof(ProgramCacheType), types.count);
+    
+    Array<ProgramCacheDefinition> definitions = ArrayAlloc<ProgramCacheDefinition>(context.arena, program->definitions.count);
+    
+    foreach(i, definitions.count)
+    {
+        Definition* def = &program->definitions[i];
+        ProgramCacheDefinition* dst = &definitions[i];
+        MemoryZero(dst, sizeof(ProgramCacheDefinition));
+        
+        dst->type = def->header.type;
+        dst->stage = def->header.stage;
+        dst->identifier = ImagePushString(writer.arena, def->header.identifier);
+        
+        if (def->header.type == DefinitionType_Function)
+        {
+            FunctionDefinition* fn = &def->function;
+            
+            dst->is_intrinsic = fn->is_intrinsic;
+            dst->objects = ProgramCachePushObjects(&writer, fn->parameters);
+            dst->returns = ProgramCachePushObjects(&writer, fn->returns);
+            if (fn->stage == DefinitionStage_Ready && !fn->is_intrinsic) dst->ir = ProgramCacheIRFrom(&writer, fn->defined.ir);
+        }
+        else if (def->header.type == DefinitionType_Struct)
+        {
+            StructDefinition* st = &def->_struct;
+            
+            Array<ObjectDefinition> members = ArrayAlloc<ObjectDefinition>(context.arena, st->names.count);
+            foreach(j, members.count) {
+                members[j] = ObjDefMake(st->names[j], st->types[j], NO_CODE, false, ValueFromZero(st->types[j]));
+            }
+            
+            dst->objects = ProgramCachePushObjects(&writer, members);
+            dst->values = ImagePush(writer.arena, st->offsets.data, sizeof(U32), st->offsets.count);
+            dst->size = st->size;
+            dst->needs_internal_release = st->needs_internal_release;
+        }
+        else if (def->header.type == DefinitionType_Enum)
+        {
+            EnumDefinition* en = &def->_enum;
+            
+            Array<ImageArray> names = ArrayAlloc<ImageArray>(context.arena, en->names.count);
+            foreach(j, names.count) names[j] = ImagePushString(writer.arena, en->names[j]);
+            
+            dst->names = ImagePush(writer.arena, names.data, sizeof(ImageArray), names.count);
+            dst->values = ImagePush(writer.arena, en->values.data, sizeof(I64), en->values.count);
+        }
+        else if (def->header.type == DefinitionType_Arg)
+        {
+            ArgDefinition* arg = &def->arg;
+            
+            dst->arg_name = ImagePushString(writer.arena, arg->name);
+            dst->arg_description = ImagePushString(writer.arena, arg->description);
+            dst->arg_type = ProgramCacheTypeIndex(&writer, arg->value_type);
+            dst->arg_required = arg->required;
+            dst->arg_default_value = ProgramCacheValueFrom(&writer, arg->default_value);
+        }
+    }
+    
+    header->definitions = ImagePush(writer.arena, definitions.data, sizeof(ProgramCacheDefinition), definitions.count);
+    
+    Array<ObjectDefinition> globals = ArrayAlloc<ObjectDefinition>(context.arena, program->globals.count);
+    foreach(i, globals.count) {
+        Global global = program->globals[i];
+        globals[i] = ObjDefMake(global.identifier, global.type, NO_CODE, global.is_constant, ValueNone());
+    }
+    header->globals = ProgramCachePushObjects(&writer, globals);
+    
+    header->globals_initialize_ir = ProgramCacheIRFrom(&writer, program->globals_initialize_ir);
+    header->front_type_count = program->front_type_count;
+    
+    if (writer.failed) return;
+    
+    ArenaPush(writer.arena, 0);
+    header->size = writer.arena->memory_position;
+    
+    // NOTE(Jose): Written to a temporary file first, a concurrent run never reads a partial entry
+    String path = ProgramCachePath(input, header->key);
+    String temp_path = StrFormat(context.arena, "%S.%l.tmp", path, (I64)OsTimerGet());
+    
+    OsCreateDirectory(input->cache_dir, true);
+    
+    if (OsWriteEntireFile(temp_path, { writer.arena->memory, header->size }).failed) return;
+    
+    OsDeleteFile(path);
+    if (OsMoveFile(path, temp_path).failed) {
+        OsDeleteFile(temp_path);
+    }
+}
+
+struct ProgramCacheReader {
+    Program* program;
+    ProgramCacheHeader* cache;
+    Type* type_type;
+    Array<Type*> types;
+};
+
+internal_fn Value ValueFromProgramCache(ProgramCacheReader* reader, ProgramCacheValue src);
+
+internal_fn Array<Value> ValuesFromProgramCache(ProgramCacheReader* reader, ImageArray array)
+{
+    Array<ProgramCacheValue> src = ImageGetArray<ProgramCacheValue>(reader->cache, array);
+    Array<Value> values = ArrayAlloc<Value>(reader->program->arena, src.count);
+    foreach(i, values.count) {
+        values[i] = ValueFromProgramCache(reader, src[i]);
+    }
+    return values;
+}
+
+internal_fn Value ValueFromProgramCache(ProgramCacheReader* reader, ProgramCacheValue src)
+{
+    Value value = {};
+    value.kind = (ValueKind)src.kind;
+    value.type = reader->types[src.type];
+    
+    if (value.kind == ValueKind_Literal && value.type == string_type) {
+        value.literal_string = ImageGetString(reader->cache, src.array);
+    }
+    else if (value.kind == ValueKind_Literal && value.type == reader->type_type) {
+        value.literal_type = reader->types[(U32)src.data];
+    }
+    else if (value.kind == ValueKind_Array) {
+        value.array.values = ValuesFromProgramCache(reader, src.array);
+    }
+    else if (value.kind == ValueKind_StringComposition) {
+        value.string_composition = ValuesFromProgramCache(reader, src.array);
+    }
+    else if (value.kind == ValueKind_MultipleReturn) {
+        value.multiple_return = ValuesFromProgramCache(reader, src.array);
+    }
+    else {
+        value.literal_uint = src.data;
+    }
+    
+    return value;
+}
+
+internal_fn IR IRFromProgramCache(ProgramCacheReader* reader, ProgramCacheIR src)
+{
+    Program* program = reader->program;
+    
+    IR ir = {};
+    ir.success = src.success;
+    ir.parameter_count = src.parameter_count;
+    ir.value = ValueFromProgramCache(reader, src.value);
+    ir.path = ImageGetString(reader->cache, src.path);
+    
+    Array<ProgramCacheUnit> units = ImageGetArray<ProgramCacheUnit>(reader->cache, src.instructions);
+    ir.instructions = ArrayAlloc<Unit>(program->arena, units.count);
+    
+    foreach(i, units.count)
+    {
+        ProgramCacheUnit* unit_src = &units[i];
+        Unit* unit = &ir.instructions[i];
+        
+        unit->kind = (UnitKind)unit_src->kind;
+        unit->line = unit_src->line;
+        unit->dst_index = unit_src->dst_index;
+        unit->op_dst_type = (PrimitiveType)unit_src->op_dst_type;
+        unit->src0 = ValueFromProgramCache(reader, unit_src->src0);
+        unit->src1 = ValueFromProgramCache(reader, unit_src->src1);
+        
+        if (unit->kind == UnitKind_FunctionCall) {
+            unit->function_call.fn = (unit_src->data[0] >= 0) ? FunctionFromIndex(program, unit_src->data[0]) : NULL;
+            unit->function_call.parameters = ValuesFromProgramCache(reader, unit_src->parameters);
+        }
+        else if (unit->kind == UnitKind_Jump) {
+            unit->jump.condition = unit_src->data[0];
+            unit->jump.offset = unit_src->data[1];
+        }
+        else if (unit->kind == UnitKind_Child) {
+            unit->child.child_is_member = unit_src->data[0];
+            unit->child.child_is_write = unit_src->data[1];
+        }
+    }
+    
+    Array<ProgramCacheRegister> registers = ImageGetArray<ProgramCacheRegister>(reader->cache, src.local_registers);
+    ir.local_registers = ArrayAlloc<Register>(program->arena, registers.count);
+    
+    foreach(i, registers.count) {
+        ir.local_registers[i].kind = (RegisterKind)registers[i].kind;
+        ir.local_registers[i].is_constant = registers[i].is_constant;
+        ir.local_registers[i].type = reader->types[registers[i].type];
+    }
+    
+    return ir;
+}
+
+internal_fn Array<ObjectDefinition> ObjectsFromProgramCache(ProgramCacheReader* reader, ImageArray array)
+{
+    Array<ProgramCacheObject> src = ImageGetArray<ProgramCacheObject>(reader->cache, array);
+    Array<ObjectDefinition> objects = ArrayAlloc<ObjectDefinition>(context.arena, src.count);
+    
+    foreach(i, src.count) {
+        String name = ImageGetString(reader->cache, src[i].name);
+        objects[i] = ObjDefMake(name, reader->types[src[i].type], NO_CODE, src[i].is_constant, ValueFromProgramCache(reader, src[i].value));
+    }
+    
+    return objects;
+}
+
+internal_fn B32 ProgramCacheIsValid(ProgramCacheHeader* cache, U64 size, U64 key)
+{
+    if (size < sizeof(ProgramCacheHeader)) return false;
+    if (cache->magic != PROGRAM_CACHE_MAGIC || cache->version != PROGRAM_CACHE_VERSION) return false;
+    if (cache->key != key || cache->size != size) return false;
+    
+    // NOTE(Jose): Any change in the scripts or their imports invalidates the entry
+    Array<ProgramCacheScript> scripts = ImageGetArray<ProgramCacheScript>(cache, cache->scripts);
+    
+    foreach(i, scripts.count)
+    {
+        ArenaCapture(context.arena);
+        
+        RBuffer file;
+        if (OsReadEntireFile(context.arena, ImageGetString(cache, scripts[i].path), &file).failed) return false;
+        if (ImageHash(StrFromRBuffer(file)) != scripts[i].hash) return false;
+    }
+    
+    Array<ProgramCacheDefinition> definitions = ImageGetArray<ProgramCacheDefinition>(cache, cache->definitions);
+    
+    foreach(i, definitions.count) {
+        if (!definitions[i].is_intrinsic) continue;
+        if (IntrinsicFromIdentifier(ImageGetString(cache, definitions[i].identifier)) == NULL) return false;
+    }
+    
+    return true;
+}
+
+B32 ProgramReadCache(Program* program, Input* input)
+{
+    PROFILE_FUNCTION;
+    
+    U64 key = ProgramCacheKey(input);
+    U64 arena_position = program->arena->memory_position;
+    
+    // NOTE(Jose): Read once into the program arena, names and strings point into it
+    RBuffer file;
+    if (OsReadEntireFile(program->arena, ProgramCachePath(input, key), &file).failed) return false;
+    
+    ProgramCacheHeader* cache = (ProgramCacheHeader*)file.data;
+    
+    if (!ProgramCacheIsValid(cache, file.size, key)) {
+        ArenaPopTo(program->arena, arena_position);
+        return false;
+    }
+    
+    Array<ProgramCacheDefinition> definitions = ImageGetArray<ProgramCacheDefinition>(cache, cache->definitions);
+    
+    program->definitions = ArrayAlloc<Definition>(program->arena, definitions.count);
+    program->definition_table = IdentifierTableAlloc(program->arena, definitions.count);
+    
+    foreach(i, definitions.count)
+    {
+        DefinitionType type = (DefinitionType)definitions[i].type;
+        
+        if (type == DefinitionType_Function) program->function_count++;
+        else if (type == DefinitionType_Struct) program->struct_count++;
+        else if (type == DefinitionType_Enum) program->enum_count++;
+        else if (type == DefinitionType_Arg) program->arg_count++;
+        
+        DefinitionIdentify(program, i, type, ImageGetString(cache, definitions[i].identifier), NO_CODE);
+    }
+    
+    ProgramCacheReader reader = {};
+    reader.program = program;
+    reader.cache = cache;
+    
+    // Every base is before the types derived from it
+    {
+        Array<ProgramCacheType> types = ImageGetArray<ProgramCacheType>(cache, cache->types);
+        reader.types = ArrayAlloc<Type*>(context.arena, PROGRAM_CACHE_BUILTIN_TYPES + types.count);
+        
+        reader.types[0] = NULL;
+        reader.types[1] = nil_type;
+        reader.types[2] = void_type;
+        reader.types[3] = any_type;
+        foreach(i, 5) reader.types[4 + i] = TypeFromPrimitive((PrimitiveType)i);
+        
+        foreach(i, types.count)
+        {
+            ProgramCacheType src = types[i];
+            Type* type = nil_type;
+            
+            if (src.kind == VKind_Struct) type = TypeFromStruct(program, StructFromIndex(program, src.index));
+            else if (src.kind == VKind_Enum) type = TypeFromEnum(program, EnumFromIndex(program, src.index));
+            else if (src.kind == VKind_Array) type = TypeFromArray(program, reader.types[src.index], 1);
+            else if (src.kind == VKind_List) type = TypeFromList(program, reader.types[src.index], 1);
+            else if (src.kind == VKind_Reference) type = TypeFromReference(program, reader.types[src.index]);
+            
+            reader.types[PROGRAM_CACHE_BUILTIN_TYPES + i] = type;
+        }
+        
+        reader.type_type = Type_Type;
+    }
+    
+    foreach(i, definitions.count)
+    {
+        ProgramCacheDefinition* src = &definitions[i];
+        Definition* def = &program->definitions[i];
+        
+        if (src->type == DefinitionType_Enum)
+        {
+            Array<ImageArray> src_names = ImageGetArray<ImageArray>(cache, src->names);
+            Array<String> names = ArrayAlloc<String>(context.arena, src_names.count);
+            foreach(j, names.count) names[j] = ImageGetString(cache, src_names[j]);
+            
+            EnumDefine(program, &def->_enum, names, {});
+            EnumResolve(program, &def->_enum, ImageGetArray<I64>(cache, src->values));
+        }
+        else if (src->type == DefinitionType_Struct)
+        {
+            StructDefine(program, &def->_struct, ObjectsFromProgramCache(&reader, src->objects));
+            StructResolveLayout(program, &def->_struct, ImageGetArray<U32>(cache, src->values), src->size, src->needs_internal_release);
+        }
+        else if (src->type == DefinitionType_Function)
+        {
+            FunctionDefinition* fn = &def->function;
+            FunctionDefine(program, fn, ObjectsFromProgramCache(&reader, src->objects), ObjectsFromProgramCache(&reader, src->returns));
+            
+            if (src->stage != DefinitionStage_Ready) continue;
+            
+            if (src->is_intrinsic) FunctionResolveIntrinsic(program, fn, IntrinsicFromIdentifier(fn->identifier));
+            else FunctionResolve(program, fn, IRFromProgramCache(&reader, src->ir));
+        }
+        else if (src->type == DefinitionType_Arg)
+        {
+            ArgDefine(program, &def->arg, reader.types[src->arg_type]);
+            
+            String name = ImageGetString(cache, src->arg_name);
+            String description = ImageGetString(cache, src->arg_description);
+            ArgResolve(program, &def->arg, name, description, src->arg_required, ValueFromProgramCache(&reader, src->arg_default_value));
+        }
+    }
+    
+    Array<ProgramCacheObject> globals = ImageGetArray<ProgramCacheObject>(cache, cache->globals);
+    
+    program->globals = ArrayAlloc<Global>(program->arena, globals.count);
+    program->global_table = IdentifierTableAlloc(program->arena, globals.count);
+    
+    foreach(i, globals.count)
+    {
+        Global* global = &program->globals[i];
+        global->identifier = ImageGetString(cache, globals[i].name);
+        global->identifier_id = InternString(global->identifier);
+        global->type = reader.types[globals[i].type];
+        global->is_constant = globals[i].is_constant;
+        
+        IdentifierTableInsert(&program->global_table, global->identifier_id, i);
+    }
+    
+    program->front_type_count = cache->front_type_count;
     
-    I32 script_id = front->scripts.count;
+    if (cache->globals_initialize_ir.success) {
+        program->globals_initialize_ir = IRFromProgramCache(&reader, cache->globals_initialize_ir);
+    }
     
-    YovScript* script = BArrayAdd(&front->scripts);
-    script->id = script_id;
-    script->path = "core.yov";
-    script->name = "core.yov";
-    script->dir = "./";
-    script->text = text;
-    return script;
+    return true;
 }
 
 YovScript* FrontGetScript(FrontContext* front, I32 script_id)
@@ -459,12 +1642,21 @@ Parser* ParserFromLocation(FrontContext* front, Location location)
     return ParserAlloc(script, location.range);
 }
 
-void FrontReadLocationsAndImports(FrontContext* front, YovScript* script, LaneGroup* lane_group)
+internal_fn void FrontReadScriptTask(void* user_data, U32 script_id)
+{
+    FrontContext* front = (FrontContext*)user_data;
+    YovScript* script = FrontGetScript(front, script_id);
+    FrontReadLocationsAndImports(front, script, &front->script_group);
+}
+
+void FrontReadLocationsAndImports(FrontContext* front, YovScript* script, TaskGroup* group)
 {
     PROFILE_FUNCTION;
     if (script == NULL) return;
     
     Reporter* reporter = front->reporter;
+    
+    script->tokens = TokenArrayFromText(front->arena, script->text, { 0, script->text.size });
     Parser* parser = ParserAlloc(script, { 0, script->text.size });
     
     BArray<U64> lines = BArrayMake<U64>(context.arena, 512);
@@ -513,8 +1705,8 @@ void FrontReadLocationsAndImports(FrontContext* front, YovScript* script, LaneGr
             String import_path = PathResolveImport(context.arena, script->dir, literal_token.value);
             YovScript* new_script = FrontAddScript(front, import_path);
             
-            if (new_script != NULL && lane_group != NULL) {
-                LaneTaskAdd(lane_group, 1);
+            if (new_script != NULL && group != NULL) {
+                TaskGroupPush(group, FrontReadScriptTask, front, new_script->id);
             }
         }
         else
@@ -584,60 +1776,66 @@ void FrontReadLocationsAndImports(FrontContext* front, YovScript* script, LaneGr
     script->lines = ArrayFromBArray(front->arena, lines);
 }
 
-void FrontReadAllScripts(LaneContext* lane, FrontContext* front)
+void FrontReadAllScripts(FrontContext* front)
 {
     PROFILE_FUNCTION;
-    LaneGroup* group = lane->group;
+    TaskGroup* group = &front->script_group;
     
-    if (LaneNarrow(lane, 0)) {
+    if (front->input->core_image_path.size == 0) {
         FrontAddScript(front, front->input->main_script_path);
-        FrontAddCoreScript(front);
     }
+    FrontAddCoreScript(front);
     
-    LaneTaskStart(lane, front->scripts.count);
-    
-    while (LaneDynamicTaskIsBusy(group))
-    {
-        U32 script_id;
-        if (LaneTaskFetch(group, &script_id))
-        {
-            YovScript* script = FrontGetScript(front, script_id);
-            FrontReadLocationsAndImports(front, script, group);
-            LaneDynamicTaskFinish(group);
-        }
-        else {
-            OsThreadYield();
-        }
+    // NOTE(Jose): Pushed backwards so the main script is the first one popped. The core script is already read if it comes from the image
+    for (U32 i = front->scripts.count; i > 0; --i) {
+        if (front->core_image != NULL && (I32)(i - 1) == front->core_script_id) continue;
+        TaskGroupPush(group, FrontReadScriptTask, front, i - 1);
     }
     
-    if (LaneNarrow(lane, 0)) {
-        front->definitions = ArrayFromBArray(front->arena, front->definition_list);
-    }
+    TaskGroupJoin(group);
     
-    LaneBarrier(lane);
+    front->definitions = ArrayFromBArray(front->arena, front->definition_list);
 }
 
-internal_fn U32 CountIdentifiers(Program* program, String identifier)
+internal_fn void FrontIdentifyRange(void* user_data, RangeU32 range)
 {
-    PROFILE_FUNCTION;
-    
-    U32 count = 0;
+    FrontContext* front = (FrontContext*)user_data;
+    Program* program = front->program;
     
-    foreach(i, program->definitions.count) {
-        if (program->definitions[i].header.identifier == identifier) count++;
+    for (U32 i = Max(range.min, front->core_definition_count); i < range.max; ++i)
+    {
+        CodeDefinition* code = &front->definitions[i];
+        
+        code->index = AtomicIncrement32(&front->index_counter) - 1;
+        DefinitionIdentify(program, code->index, code->type, code->identifier, code->entire_location);
     }
+}
+
+internal_fn void FrontCheckDuplicationsRange(void* user_data, RangeU32 range)
+{
+    FrontContext* front = (FrontContext*)user_data;
+    Reporter* reporter = front->reporter;
+    Program* program = front->program;
     
-    return count;
+    for (U32 i = range.min; i < range.max; ++i)
+    {
+        DefinitionHeader* def = &program->definitions[i].header;
+        
+        IdentifierSlot* slot = IdentifierTableFind(&program->definition_table, def->identifier_id);
+        
+        if (slot->count > 1) {
+            ReportErrorFront(def->location, "Duplicated definition '%S'", def->identifier);
+            continue;
+        }
+    }
 }
 
-void FrontIdentifyDefinitions(LaneContext* lane, FrontContext* front)
+void FrontIdentifyDefinitions(FrontContext* front)
 {
     PROFILE_FUNCTION;
     
-    Reporter* reporter = front->reporter;
     Program* program = front->program;
     
-    if (LaneNarrow(lane))
     {
         U32 definition_count = 0;
         definition_count += front->function_count;
@@ -646,58 +1844,30 @@ void FrontIdentifyDefinitions(LaneContext* lane, FrontContext* front)
         definition_count += front->arg_count;
         
         program->definitions = ArrayAlloc<Definition>(program->arena, definition_count);
+        program->definition_table = IdentifierTableAlloc(program->arena, definition_count);
         program->function_count = front->function_count;
         program->struct_count = front->struct_count;
         program->enum_count = front->enum_count;
         program->arg_count = front->arg_count;
     }
     
-    LaneBarrier(lane);
-    
-    // Identify
-    {
-        RangeU32 range = LaneDistributeUniformWork(lane, front->definitions.count);
-        
-        for (U32 i = range.min; i < range.max; ++i)
-        {
-            CodeDefinition* code = &front->definitions[i];
-            
-            code->index = AtomicIncrement32(&front->index_counter) - 1;
-            DefinitionIdentify(program, code->index, code->type, code->identifier, code->entire_location);
-        }
-        
-        LaneBarrier(lane);
+    // NOTE(Jose): The core definitions keep the indices of the image
+    if (front->core_image != NULL) {
+        FrontMapCoreImage(front);
+        front->index_counter = front->core_definition_count;
     }
     
-    // Check for duplications
-    {
-        RangeU32 range = LaneDistributeUniformWork(lane, program->definitions.count);
-        
-        for (U32 i = range.min; i < range.max; ++i)
-        {
-            DefinitionHeader* def = &program->definitions[i].header;
-            
-            U32 count = CountIdentifiers(program, def->identifier);
-            
-            if (count > 1) {
-                ReportErrorFront(def->location, "Duplicated definition '%S'", def->identifier);
-                continue;
-            }
-        }
-        
-        LaneBarrier(lane);
-    }
+    TaskParallelFor(FrontIdentifyRange, front, front->definitions.count);
+    TaskParallelFor(FrontCheckDuplicationsRange, front, program->definitions.count);
     
     Assert(front->index_counter == program->definitions.count);
 }
 
-void FrontDefineDefinitions(LaneContext* lane, FrontContext* front)
+internal_fn void FrontDefineRange(void* user_data, RangeU32 range)
 {
-    PROFILE_FUNCTION;
-    
-    RangeU32 range = LaneDistributeUniformWork(lane, front->definitions.count);
+    FrontContext* front = (FrontContext*)user_data;
     
-    for (U32 i = range.min; i < range.max; ++i)
+    for (U32 i = Max(range.min, front->core_definition_count); i < range.max; ++i)
     {
         CodeDefinition* code = &front->definitions[i];
         
@@ -717,8 +1887,12 @@ void FrontDefineDefinitions(LaneContext* lane, FrontContext* front)
             FrontDefineArg(front, code);
         }
     }
-    
-    LaneBarrier(lane);
+}
+
+void FrontDefineDefinitions(FrontContext* front)
+{
+    PROFILE_FUNCTION;
+    TaskParallelFor(FrontDefineRange, front, front->definitions.count);
 }
 
 
@@ -728,6 +1902,7 @@ internal_fn void DefineLangGlobal(FrontContext* front, String name, String type)
     
     Global global = {};
     global.identifier = name;
+    global.identifier_id = InternString(name);
     global.type = TypeFromName(front->program, type);
     global.is_constant = true;
     
@@ -736,59 +1911,80 @@ internal_fn void DefineLangGlobal(FrontContext* front, String name, String type)
     MutexUnlock(&front->mutex);
 }
 
-void FrontDefineGlobals(LaneContext* lane, FrontContext* front)
+internal_fn void FrontDefineGlobalsRange(void* user_data, RangeU32 range)
 {
-    PROFILE_FUNCTION;
-    
+    FrontContext* front = (FrontContext*)user_data;
     Program* program = front->program;
     Reporter* reporter = front->reporter;
     
-    if (LaneNarrow(lane))
+    for (U32 i = Max(range.min, front->core_global_location_count); i < range.max; ++i)
     {
-        DefineLangGlobal(front, "yov", "YovInfo");
-        DefineLangGlobal(front, "os", "OS");
-        DefineLangGlobal(front, "context", "Context");
-        DefineLangGlobal(front, "calls", "CallsContext");
+        Location location = front->global_location_list[i];
+        
+        ObjectDefinitionResult res = ReadObjectDefinition(context.arena, ParserFromLocation(front, location), reporter, program, false, RegisterKind_Global);
+        if (!res.success) continue;
+        
+        Array<Global> globals = ArrayAlloc<Global>(context.arena, res.objects.count);
+        
+        foreach(i, globals.count)
+        {
+            ObjectDefinition def = res.objects[i];
+            
+            Global global = {};
+            global.identifier = StrCopy(program->arena, def.name);
+            global.identifier_id = InternString(def.name);
+            global.type = def.type;
+            global.is_constant = def.is_constant;
+            
+            Assert(TypeIsValid(def.type));
+            
+            globals[i] = global;
+        }
+        
+        MutexLock(&front->mutex);
+        foreach(i, globals.count)
+            BArrayAdd(&front->global_list, globals[i]);
+        MutexUnlock(&front->mutex);
     }
+}
+
+void FrontDefineGlobals(FrontContext* front)
+{
+    PROFILE_FUNCTION;
     
-    RangeU32 code_range = LaneDistributeUniformWork(lane, front->global_location_list.count);
+    Program* program = front->program;
     
-    // Define code globals
+    if (front->core_image != NULL)
     {
-        for (U32 i = code_range.min; i < code_range.max; ++i)
+        CoreImageHeader* image = front->core_image;
+        Array<CoreImageObject> globals = ImageGetArray<CoreImageObject>(image, image->globals);
+        Array<CoreImageType> types = ImageGetArray<CoreImageType>(image, image->types);
+        
+        foreach(i, globals.count)
         {
-            Location location = front->global_location_list[i];
-            
-            ObjectDefinitionResult res = ReadObjectDefinition(context.arena, ParserFromLocation(front, location), reporter, program, false, RegisterKind_Global);
-            if (!res.success) continue;
+            String identifier = ImageGetString(image, globals[i].name);
             
-            Array<Global> globals = ArrayAlloc<Global>(context.arena, res.objects.count);
-            
-            foreach(i, globals.count)
-            {
-                ObjectDefinition def = res.objects[i];
-                
-                Global global = {};
-                global.identifier = StrCopy(program->arena, def.name);
-                global.type = def.type;
-                global.is_constant = def.is_constant;
-                
-                Assert(TypeIsValid(def.type));
-                
-                globals[i] = global;
-            }
+            Global global = {};
+            global.identifier = identifier;
+            global.identifier_id = InternString(identifier);
+            global.type = TypeFromCoreImage(program, types[globals[i].type]);
+            global.is_constant = globals[i].is_constant;
             
-            MutexLock(&front->mutex);
-            foreach(i, globals.count)
-                BArrayAdd(&front->global_list, globals[i]);
-            MutexUnlock(&front->mutex);
+            BArrayAdd(&front->global_list, global);
         }
-        
-        LaneBarrier(lane);
     }
+    else
+    {
+        DefineLangGlobal(front, "yov", "YovInfo");
+        DefineLangGlobal(front, "os", "OS");
+        DefineLangGlobal(front, "context", "Context");
+        DefineLangGlobal(front, "calls", "CallsContext");
+    }
+    
+    // Define code globals
+    TaskParallelFor(FrontDefineGlobalsRange, front, front->global_location_list.count);
     
     // Define args globals
-    if (LaneNarrow(lane))
     {
         foreach(i, program->definitions.count)
         {
@@ -798,6 +1994,7 @@ void FrontDefineGlobals(LaneContext* lane, FrontContext* front)
             
             Global global = {};
             global.identifier = StrCopy(program->arena, def.identifier);
+            global.identifier_id = def.identifier_id;
             global.type = def.value_type;
             global.is_constant = true;
             
@@ -806,15 +2003,38 @@ void FrontDefineGlobals(LaneContext* lane, FrontContext* front)
             BArrayAdd(&front->global_list, global);
         }
     }
-    LaneBarrier(lane);
     
-    if (LaneNarrow(lane)) {
-        program->globals = ArrayFromBArray(program->arena, front->global_list);
+    program->globals = ArrayFromBArray(program->arena, front->global_list);
+    program->global_table = IdentifierTableAlloc(program->arena, program->globals.count);
+    
+    foreach(i, program->globals.count) {
+        IdentifierTableInsert(&program->global_table, program->globals[i].identifier_id, i);
+    }
+}
+
+internal_fn void FrontResolveGlobalsRange(void* user_data, RangeU32 range)
+{
+    FrontContext* front = (FrontContext*)user_data;
+    Reporter* reporter = front->reporter;
+    Program* program = front->program;
+    
+    for (U32 i = range.min; i < range.max; ++i)
+    {
+        Location location = front->global_location_list[i];
+        
+        IR_Context* ir_context = IrContextAlloc(program, reporter);
+        
+        ObjectDefinitionResult res = ReadObjectDefinitionWithIr(context.arena, ParserFromLocation(front, location), ir_context, false, RegisterKind_Global);
+        if (!res.success) continue;
+        
+        MutexLock(&front->mutex);
+        front->global_initialize_group = IRAppend(front->global_initialize_group, res.out);
+        front->number_of_registers_for_global_initialize = Max(front->number_of_registers_for_global_initialize, ir_context->local_registers.count);
+        MutexUnlock(&front->mutex);
     }
-    LaneBarrier(lane);
 }
 
-void FrontResolveGlobals(LaneContext* lane, FrontContext* front)
+void FrontResolveGlobals(FrontContext* front)
 {
     PROFILE_FUNCTION;
     
@@ -822,169 +2042,278 @@ void FrontResolveGlobals(LaneContext* lane, FrontContext* front)
     Program* program = front->program;
     
     // Code globals
+    TaskParallelFor(FrontResolveGlobalsRange, front, front->global_location_list.count);
+    
+    // Args
     {
-        RangeU32 code_range = LaneDistributeUniformWork(lane, front->global_location_list.count);
+        IR_Context* ir_context = IrContextAlloc(program, reporter);
         
-        for (U32 i = code_range.min; i < code_range.max; ++i)
+        foreach(i, program->definitions.count)
         {
-            Location location = front->global_location_list[i];
-            
-            IR_Context* ir_context = IrContextAlloc(program, reporter);
+            ArgDefinition* def = &program->definitions[i].arg;
+            if (def->type != DefinitionType_Arg) continue;
             
-            ObjectDefinitionResult res = ReadObjectDefinitionWithIr(context.arena, ParserFromLocation(front, location), ir_context, false, RegisterKind_Global);
-            if (!res.success) continue;
+            Value value = def->default_value;
             
-            MutexLock(&front->mutex);
-            front->global_initialize_group = IRAppend(front->global_initialize_group, res.out);
-            front->number_of_registers_for_global_initialize = Max(front->number_of_registers_for_global_initialize, ir_context->local_registers.count);
-            MutexUnlock(&front->mutex);
-        }
-    }
-    LaneBarrier(lane);
-    
-    
-    if (LaneNarrow(lane))
-    {
-        // Args
-        {
-            IR_Context* ir_context = IrContextAlloc(program, reporter);
+            ScriptArg* script_arg = InputFindScriptArg(front->input, def->name);
             
-            foreach(i, program->definitions.count)
+            if (script_arg == NULL) {
+                if (def->required) {
+                    report_arg_is_required(def->location, def->name);
+                    continue;
+                }
+            }
+            else
             {
-                ArgDefinition* def = &program->definitions[i].arg;
-                if (def->type != DefinitionType_Arg) continue;
+                value = ValueNone();
                 
-                Value value = def->default_value;
-                
-                ScriptArg* script_arg = InputFindScriptArg(front->input, def->name);
-                
-                if (script_arg == NULL) {
-                    if (def->required) {
-                        report_arg_is_required(def->location, def->name);
-                        continue;
+                if (script_arg->value.size <= 0)
+                {
+                    if (def->value_type == bool_type) {
+                        value = ValueFromBool(true);
                     }
                 }
                 else
                 {
-                    value = ValueNone();
-                    
-                    if (script_arg->value.size <= 0)
-                    {
-                        if (def->value_type == bool_type) {
-                            value = ValueFromBool(true);
-                        }
-                    }
-                    else
-                    {
-                        value = ValueFromStringExpression(program->arena, script_arg->value, def->value_type);
-                    }
-                    
-                    if (value.kind == ValueKind_None) {
-                        report_arg_wrong_value(def->name, script_arg->value);
-                        continue;
-                    }
+                    value = ValueFromStringExpression(program->arena, script_arg->value, def->value_type);
                 }
                 
-                I32 global_index = GlobalIndexFromIdentifier(program, def->identifier);
-                
-                if (global_index >= 0)
-                {
-                    front->global_initialize_group = IRAppend(front->global_initialize_group, IRFromStore(ir_context, ValueFromGlobal(program, global_index), value, def->location));
-                    front->number_of_registers_for_global_initialize = Max(front->number_of_registers_for_global_initialize, ir_context->local_registers.count);
+                if (value.kind == ValueKind_None) {
+                    report_arg_wrong_value(def->name, script_arg->value);
+                    continue;
                 }
             }
+            
+            I32 global_index = GlobalIndexFromIdentifier(program, def->identifier);
+            
+            if (global_index >= 0)
+            {
+                front->global_initialize_group = IRAppend(front->global_initialize_group, IRFromStore(ir_context, ValueFromGlobal(program, global_index), value, def->location));
+                front->number_of_registers_for_global_initialize = Max(front->number_of_registers_for_global_initialize, ir_context->local_registers.count);
+            }
         }
+    }
+    
+    if (front->global_initialize_group.success)
+    {
+        Array<Register> registers = ArrayAlloc<Register>(context.arena, front->number_of_registers_for_global_initialize);
         
-        if (front->global_initialize_group.success)
+        foreach(i, registers.count)
         {
-            Array<Register> registers = ArrayAlloc<Register>(context.arena, front->number_of_registers_for_global_initialize);
-            
-            foreach(i, registers.count)
-            {
-                Register reg = {};
-                reg.kind = RegisterKind_Local;
-                reg.is_constant = false;
-                reg.type = any_type;
-                
-                registers[i] = reg;
-            };
+            Register reg = {};
+            reg.kind = RegisterKind_Local;
+            reg.is_constant = false;
+            reg.type = any_type;
             
-            program->globals_initialize_ir = MakeIR(program->arena, program, registers, front->global_initialize_group, NULL);
+            registers[i] = reg;
+        };
+        
+        program->globals_initialize_ir = MakeIR(program->arena, program, registers, front->global_initialize_group, NULL);
+    }
+}
+
+internal_fn B32 FrontResolveCode(FrontContext* front, CodeDefinition* code)
+{
+    Program* program = front->program;
+    
+    AtomicIncrement32(&front->resolve_attempts);
+    
+    if (code->type == DefinitionType_Enum) {
+        EnumDefinition* def = EnumFromIndex(program, code->index);
+        FrontResolveEnum(front, def);
+        return true;
+    }
+    else if (code->type == DefinitionType_Struct) {
+        StructDefinition* def = StructFromIndex(program, code->index);
+        return FrontResolveStruct(front, def);
+    }
+    else if (code->type == DefinitionType_Function) {
+        FunctionDefinition* def = FunctionFromIndex(program, code->index);
+        FrontResolveFunction(front, def, code);
+        return true;
+    }
+    
+    FrontResolveArg(front, code);
+    return true;
+}
+
+internal_fn void FrontResolveTask(void* user_data, U32 index);
+
+void FrontRequestCode(FrontContext* front, U32 index)
+{
+    if (AtomicCompareExchange32_Full(&front->resolve_requested[index], 0, 1) != 0) return;
+    TaskGroupPush(&front->resolve_group, FrontResolveTask, front, index);
+}
+
+void FrontRequestCalls(FrontContext* front, IR ir)
+{
+    foreach(i, ir.instructions.count)
+    {
+        Unit* unit = &ir.instructions[i];
+        if (unit->kind != UnitKind_FunctionCall) continue;
+        FrontRequestCode(front, IndexFromDefinition(front->program, unit->function_call.fn));
+    }
+}
+
+internal_fn void FrontResolveTask(void* user_data, U32 index)
+{
+    FrontContext* front = (FrontContext*)user_data;
+    
+    F64 start_time = TimerNow();
+    
+    CodeDefinition* code = front->resolve_codes[index];
+    
+    if (FrontResolveCode(front, code))
+    {
+        U32 begin = front->resolve_dependents_offset[index];
+        U32 end = front->resolve_dependents_offset[index + 1];
+        
+        for (U32 i = begin; i < end; ++i)
+        {
+            U32 dependent = front->resolve_dependents[i];
+            if (AtomicDecrement32(&front->resolve_pending[dependent]) == 0) {
+                TaskGroupPush(&front->resolve_group, FrontResolveTask, front, dependent);
+            }
         }
     }
     
-    LaneBarrier(lane);
+    front->resolve_worker_busy_time[context.worker_index] += TimerNow() - start_time;
 }
 
-void FrontResolveDefinitions(LaneContext* lane, FrontContext* front)
+void FrontResolveDefinitions(FrontContext* front)
 {
     PROFILE_FUNCTION;
     
     Program* program = front->program;
     
-    LaneBarrier(lane);
+    F64 start_time = TimerNow();
+    
+    TaskGroup* group = &front->resolve_group;
     
-    while (front->resolve_count < front->definitions.count)
+    // Dependency graph
     {
-        RangeU32 range = LaneDistributeUniformWork(lane, front->definitions.count);
+        U32 count = program->definitions.count;
+        
+        front->resolve_codes = ArrayAlloc<CodeDefinition*>(front->arena, count);
+        front->resolve_pending = ArrayAlloc<U32>(front->arena, count);
+        front->resolve_dependents_offset = ArrayAlloc<U32>(front->arena, count + 1);
+        front->resolve_worker_busy_time = ArrayAlloc<F64>(front->arena, task_pool.worker_count);
+        front->resolve_requested = ArrayAlloc<U32>(front->arena, count);
+        front->resolve_attempts = 0;
+        
+        foreach(i, count) {
+            front->resolve_pending[i] = 0;
+            front->resolve_dependents_offset[i] = 0;
+            front->resolve_requested[i] = 0;
+        }
+        front->resolve_dependents_offset[count] = 0;
+        foreach(i, task_pool.worker_count) front->resolve_worker_busy_time[i] = 0.0;
+        
+        U32 edge_count = 0;
         
-        for (U32 i = range.min; i < range.max; ++i)
+        foreach(i, front->definitions.count)
         {
             CodeDefinition* code = &front->definitions[i];
+            front->resolve_codes[code->index] = code;
             
-            B32 resolved = false;
-            
-            if (code->type == DefinitionType_Enum) {
-                resolved = true;
-                EnumDefinition* def = EnumFromIndex(program, code->index);
-                FrontResolveEnum(front, def);
-            }
-            else if (code->type == DefinitionType_Struct) {
-                StructDefinition* def = StructFromIndex(program, code->index);
-                resolved = FrontResolveStruct(front, def);
+            foreach(j, code->dependencies.count) {
+                front->resolve_dependents_offset[code->dependencies[j] + 1]++;
+                front->resolve_pending[code->index]++;
+                edge_count++;
             }
-            else if (code->type == DefinitionType_Function) {
-                resolved = true;
-                FunctionDefinition* def = FunctionFromIndex(program, code->index);
-                FrontResolveFunction(front, def, code);
-            }
-            else {
-                resolved = true;
-                FrontResolveArg(front, code);
+        }
+        
+        foreach(i, count) {
+            front->resolve_dependents_offset[i + 1] += front->resolve_dependents_offset[i];
+        }
+        
+        front->resolve_dependents = ArrayAlloc<U32>(front->arena, edge_count);
+        Array<U32> cursors = ArrayCopy(context.arena, front->resolve_dependents_offset);
+        
+        foreach(i, front->definitions.count)
+        {
+            CodeDefinition* code = &front->definitions[i];
+            foreach(j, code->dependencies.count) {
+                U32 dependency = code->dependencies[j];
+                front->resolve_dependents[cursors[dependency]++] = code->index;
             }
+        }
+    }
+    
+    // Types, the ones without dependencies start the group
+    {
+        for (U32 i = front->definitions.count; i > 0; --i)
+        {
+            CodeDefinition* code = &front->definitions[i - 1];
+            if (code->type != DefinitionType_Enum && code->type != DefinitionType_Struct) continue;
+            if (front->resolve_pending[code->index] > 0) continue;
+            TaskGroupPush(group, FrontResolveTask, front, code->index);
+        }
+        
+        TaskGroupJoin(group);
+    }
+    
+    // NOTE(Jose): Function bodies can read values of any enum, so they wait for every type to be resolved.
+    // Tasks are stolen from the oldest side, so the biggest ones are pushed first for the idle workers
+    {
+        foreach(i, front->definitions.count)
+        {
+            CodeDefinition* code = &front->definitions[i];
+            if (code->type != DefinitionType_Struct) continue;
             
-            if (resolved) {
-                AtomicIncrement32(&front->resolve_count);
+            StructDefinition* def = StructFromIndex(program, code->index);
+            if (def->stage != DefinitionStage_Ready) {
+                // Recursive structs never get their dependencies resolved
+                InvalidCodepath();
             }
         }
         
-        LaneBarrier(lane);
+        BArray<SortKeyU64> keys = BArrayMake<SortKeyU64>(context.arena, 64);
         
-        if (LaneNarrow(lane))
+        foreach(i, front->definitions.count)
         {
-            if (front->resolve_count < front->definitions.count)
-            {
-                if (front->last_resolve_count == front->resolve_count) {
-                    InvalidCodepath();
-                    AtomicStore32(&front->resolve_count, front->definitions.count);
-                }
-                else {
-                    front->last_resolve_count = front->resolve_count;
-                    AtomicStore32(&front->resolve_count, 0);
-                }
-            }
+            CodeDefinition* code = &front->definitions[i];
+            
+            Location body_location = {};
+            if (code->type == DefinitionType_Function) body_location = code->function.body_location;
+            else if (code->type == DefinitionType_Arg) body_location = code->arg.body_location;
+            else continue;
+            
+            // Intrinsics have no body, they are always resolved to keep reporting the missing ones
+            B32 is_root = code->type == DefinitionType_Arg || !LocationIsValid(body_location);
+            if (!front->resolve_all && !is_root) continue;
+            
+            front->resolve_requested[code->index] = 1;
+            
+            U64 size = 0;
+            if (LocationIsValid(body_location)) size = body_location.range.max - body_location.range.min;
             
-            front->resolve_iterations++;
+            SortKeyU64 key = {};
+            key.key = U64_MAX - size;
+            key.index = code->index;
+            BArrayAdd(&keys, key);
         }
         
-        LaneBarrier(lane);
+        Array<SortKeyU64> sorted = ArrayFromBArray(context.arena, keys);
+        SortRadix(context.arena, sorted);
+        
+        foreach(i, sorted.count) {
+            TaskGroupPush(group, FrontResolveTask, front, sorted[i].index);
+        }
+        
+        TaskGroupJoin(group);
     }
     
-    if (LaneNarrow(lane)) {
-        LogFlow("Resove iterations: %u", front->resolve_iterations);
+    {
+        F64 ellapsed = TimerNow() - start_time;
+        
+        LogFlow("Resolve attempts: %u for %u definitions", front->resolve_attempts, program->definitions.count);
+        
+        foreach(i, task_pool.worker_count) {
+            F64 busy = front->resolve_worker_busy_time[i];
+            LogFlow("Resolve worker %u busy: %S of %S", i, StringFromEllapsedTime(busy), StringFromEllapsedTime(ellapsed));
+        }
     }
-    
-    LaneBarrier(lane);
 }
 
 void FrontDefineEnum(FrontContext* front, CodeDefinition* code)
@@ -1127,6 +2456,26 @@ void FrontDefineStruct(FrontContext* front, CodeDefinition* code)
     if (!valid) return;
     
     StructDefine(program, def, ArrayFromBArray(context.arena, members));
+    
+    // Member structs need to be resolved first to know the size
+    BArray<U32> dependencies = BArrayMake<U32>(context.arena, 8);
+    
+    foreach(i, def->types.count)
+    {
+        Type* type = def->types[i];
+        if (type->kind != VKind_Struct) continue;
+        
+        U32 index = IndexFromDefinition(program, type->_struct);
+        
+        B32 duplicated = false;
+        foreach_BArray(it, &dependencies) {
+            if (*it.value == index) duplicated = true;
+        }
+        
+        if (!duplicated) BArrayAdd(&dependencies, index);
+    }
+    
+    code->dependencies = ArrayFromBArray(front->arena, dependencies);
 }
 
 void FrontDefineFunction(FrontContext* front, CodeDefinition* code)
@@ -1288,7 +2637,7 @@ void FrontResolveFunction(FrontContext* front, FunctionDefinition* def, CodeDefi
     PROFILE_FUNCTION;
     
     Program* program = front->program;
-    Reporter* reporter = front->reporter;
+    Reporter* reporter = front->body_reporter;
     
     if (def->stage == DefinitionStage_Ready) {
         return;
@@ -1321,7 +2670,10 @@ void FrontResolveFunction(FrontContext* front, FunctionDefinition* def, CodeDefi
         
         if (LocationIsValid(code->function.parameters_location)) {
             ObjectDefinitionResult params = ReadDefinitionListWithIr(context.arena, ParserFromLocation(front, code->function.parameters_location), ir, RegisterKind_Parameter);
-            if (!params.success) return;
+            if (!params.success) {
+                FunctionResolve(program, def, {});
+                return;
+            }
             
             out = IRAppend(out, params.out);
         }
@@ -1348,9 +2700,15 @@ void FrontResolveFunction(FrontContext* front, FunctionDefinition* def, CodeDefi
             
             if (!IRValidateReturnPath(units)) {
                 report_function_no_return(block_location, def->identifier);
+                res.success = false;
             }
         }
         
+        // NOTE(Jose): Callees are requested before the body is ready, the runtime relies on it when waiting for them
+        if (!front->resolve_all) {
+            FrontRequestCalls(front, res);
+        }
+        
         FunctionResolve(program, def, res);
     }
 }
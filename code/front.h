@@ -15,6 +15,7 @@ enum TokenKind {
     TokenKind_StringLiteral,
     TokenKind_CodepointLiteral,
     TokenKind_Dot,
+    TokenKind_Range, // ..
     TokenKind_Comma,
     TokenKind_Colon,
     TokenKind_Arrow,
@@ -96,7 +97,6 @@ Location LocationFromToken(Token token);
 Location LocationFromTokens(Array<Token> tokens);
 
 Token ReadToken(String text, U64 cursor, I32 script_id);
-Token ReadValidToken(String text, U64 cursor, U64 end_cursor, I32 script_id);
 B32 TokenIsValid(TokenKind token);
 
 B32 CheckTokensAreCouple(Array<Token> tokens, U32 open_index, U32 close_index, TokenKind open_token, TokenKind close_token);
@@ -116,6 +116,19 @@ enum SentenceKind {
     SentenceKind_ArgDef,
 };
 
+// NOTE(Jose): Valid tokens of a range of text, only separators, comments and new lines are discarded.
+// Stored as separate arrays because the parser mostly scans kinds
+struct TokenArray {
+    U8* kinds;
+    U32* starts;
+    U32* lengths;
+    U32* matches; // Index of the closing token for '(', '[' and '{', U32_MAX otherwise
+    U32 count;
+    RangeU64 range;
+};
+
+TokenArray TokenArrayFromText(Arena* arena, String text, RangeU64 range);
+
 struct YovScript {
     I32 id;
     String path;
@@ -123,6 +136,7 @@ struct YovScript {
     String dir;
     String text;
     Array<U64> lines;
+    TokenArray tokens;
 };
 
 struct Parser {
@@ -132,17 +146,20 @@ struct Parser {
     RangeU64 range;
     U64 cursor;
     
+    TokenArray* tokens;
+    U32 token_index; // First token at or after the cursor
+    U32 token_end;   // First token at or after the end of the range
+
 #if DEV
     String debug_str;
 #endif
-    // TODO(Jose): Cache tokens
 };
 
 Parser* ParserAlloc(YovScript* script, RangeU64 range);
 Parser* ParserSub(Parser* parser, Location location);
 Location LocationFromParser(Parser* parser, U64 end = U64_MAX);
 
-Token PeekToken(Parser* parser, I64 cursor_offset = 0);
+Token PeekToken(Parser* parser, U32 token_offset = 0);
 void  SkipToken(Parser* parser, Token token);
 void  AssumeToken(Parser* parser, TokenKind kind);
 void  MoveCursor(Parser* parser, U64 cursor);
@@ -184,27 +201,57 @@ struct IR_Unit {
         
         struct {
             B32 child_is_member;
+            B32 child_is_write;
         } child;
     };
     
-    IR_Unit* prev;
-    IR_Unit* next;
+    I32 index; // Instruction index, assigned by MakeIR
 };
 
+#define IR_SEGMENT_CAPACITY 16
+
+struct IR_Segment {
+    IR_Segment* next;
+    U32 count;
+    IR_Unit* units[IR_SEGMENT_CAPACITY];
+};
+
+// NOTE(Jose): Units are stored in a chain of contiguous segments. Small groups are copied into the tail segment
+// and big ones are linked, so appends stay O(1) and MakeIR reads the units in order.
+// A group with a single unit keeps it in "single" and doesn't allocate any segment
+
 struct IR_Group {
     B32 success;
     Value value;
     U32 unit_count;
-    IR_Unit* first;
-    IR_Unit* last;
+    IR_Unit* single;
+    IR_Segment* first;
+    IR_Segment* last;
 };
 
 struct IR_Object {
     String identifier;
+    U32 identifier_id;
     Type* type;
     U32 assignment_count;
+    U32 write_count; // Stores and references that start from this object, including the ones through its members
     I32 register_index;
     I32 scope;
+    I32 shadowed_index; // Previous visible object with the same identifier
+};
+
+// NOTE(Jose): Maps an identifier to its innermost visible object. Objects are a stack ordered by scope,
+// popping a scope truncates the stack and restores the shadowed objects. Identifiers are never removed
+
+struct IR_ObjectSlot {
+    U32 identifier_id;
+    I32 object_index;
+};
+
+struct IR_ObjectTable {
+    IR_ObjectSlot* slots;
+    U32 capacity;
+    U32 count;
 };
 
 struct IR_LoopingScope {
@@ -220,6 +267,9 @@ struct IR_Context {
     
     BArray<Register> local_registers;
     BArray<IR_Object> objects;
+    IR_ObjectTable object_table;
+    BArray<I32> register_objects; // Local register -> first object bound to it
+    BArray<IR_Unit*> register_children; // Local register -> child unit that loaded it
     BArray<IR_LoopingScope> looping_scopes;
     I32 scope;
 };
@@ -267,6 +317,8 @@ IR_Group IRFromSingle(IR_Unit* unit, Value value = ValueNone());
 IR_Group IRAppend(IR_Group o0, IR_Group o1);
 IR_Group IRAppend3(IR_Group o0, IR_Group o1, IR_Group o2);
 IR_Group IRAppend4(IR_Group o0, IR_Group o1, IR_Group o2, IR_Group o3);
+IR_Unit* IRGroupFirst(IR_Group group);
+IR_Unit* IRGroupLast(IR_Group group);
 IR_Group IRFromDefineObject(IR_Context* ir, RegisterKind register_kind, String identifier, Type* type, B32 constant, Location location);
 IR_Group IRFromDefineTemporal(IR_Context* ir, Type* type, Location location);
 IR_Group IRFromReference(IR_Context* ir, B32 expects_lvalue, Value value, Location location);
@@ -277,6 +329,7 @@ IR_Group IRFromFunctionCallName(IR_Context* ir, String name, Array<Value> parame
 IR_Group IRFromDefaultInitializer(IR_Context* ir, Type* type, Location location);
 IR_Group IRFromEmptyArray(IR_Context* ir, Type* base_type, Array<Value> dimensions, Location location);
 IR_Group IRFromEmptyList(IR_Context* ir, Type* base_type, Array<Value> dimensions, Location location);
+IR_Group IRFromSlice(IR_Context* ir, Value src, Value begin, Value end, Location location);
 IR_Group IRFromStore(IR_Context* ir, Value dst, Value src, Location location);
 IR_Group IRFromCopy(IR_Context* ir, Value dst, Value src, Location location);
 IR_Group IRFromAssignment(IR_Context* ir, B32 expects_lvalue, Value dst, Value src, OperatorKind op, Location location);
@@ -287,6 +340,7 @@ IR_Group IRFromSignOperator(IR_Context* ir, Value src, OperatorKind op, Location
 IR_Group IRFromCasting(IR_Context* ir, Value src, Type* type, B32 bitcast, Location location);
 IR_Group IRFromOptionalCasting(IR_Context* ir, Value src, Type* type, Location location);
 IR_Group IRFromChild(IR_Context* ir, Value src, Value index, B32 is_member, Type* type, Location location);
+void IRMarkWrite(IR_Context* ir, Value value);
 IR_Group IRFromChildAccess(IR_Context* ir, Value src, String child_name, ExpresionContext context, Location location);
 IR_Group IRFromIfStatement(IR_Context* ir, Value condition, IR_Group success, IR_Group failure, Location location);
 IR_Group IRFromLoop(IR_Context* ir, IR_Group init, IR_Group condition, IR_Group content, IR_Group update, Location location);
@@ -342,6 +396,8 @@ struct CodeDefinition {
     String identifier;
     U32 index;
     
+    Array<U32> dependencies; // Definitions that must be resolved first, filled on define
+    
     Location entire_location;
     union {
         struct {
@@ -365,6 +421,176 @@ struct CodeDefinition {
 
 B32 ReadCodeDefinition(CodeDefinition* dst, Parser* parser, Reporter* reporter, SentenceKind op);
 
+// IMAGES
+
+// NOTE(Jose): Images are flat blobs used in place, after being embedded in the executable or read from disk.
+// Pointers are stored as offsets from the start of the image, types and definitions as indices
+
+struct ImageArray {
+    U32 offset; // Bytes from the start of the image
+    U32 count;
+};
+
+// CORE IMAGE
+
+// NOTE(Jose): core.yov is compiled at build time into an image embedded in the executable (see -core_image).
+// Locations are stored without script, so the image is mapped into any program instead of lexing and parsing core.yov.
+// Function bodies and global initializers are still compiled from the mapped tokens when they are needed
+
+#define CORE_IMAGE_MAGIC 0x494F5659
+#define CORE_IMAGE_VERSION 2
+
+struct CoreImageLocation {
+    U64 min; // U64_MAX for no code
+    U64 max;
+};
+
+struct CoreImageType {
+    U32 kind;    // VKind of the base type
+    U32 index;   // Primitive type or definition index of the base type
+    U32 derived; // VKinds applied to the base type, 8 bits each starting from the lowest ones
+};
+
+struct CoreImageObject {
+    ImageArray name;
+    U32 type;
+    U32 is_constant;
+    CoreImageLocation location;
+};
+
+struct CoreImageDefinition {
+    U32 type; // DefinitionType
+    U32 return_is_list;
+    ImageArray identifier;
+    CoreImageLocation entire_location;
+    CoreImageLocation locations[4]; // Function body, parameters, returns and generics. Body of enums and structs
+    
+    ImageArray objects; // Struct members or function parameters
+    ImageArray returns;
+    ImageArray names; // Enum names
+    ImageArray expression_locations;
+    ImageArray values; // Enum values or struct offsets
+    U32 size;
+    U32 needs_internal_release;
+};
+
+struct CoreImageHeader {
+    U32 magic;
+    U32 version;
+    U64 source_hash;
+    U64 layout_hash; // Enum counts and struct sizes the image was written with
+    U32 size;
+    U32 token_count;
+    
+    ImageArray token_kinds;
+    ImageArray token_starts;
+    ImageArray token_lengths;
+    ImageArray token_matches;
+    ImageArray lines;
+    
+    ImageArray types;
+    ImageArray definitions;
+    ImageArray global_locations;
+    ImageArray globals; // Including the language globals
+};
+
+// PROGRAM CACHE
+
+// NOTE(Jose): A resolved program stored on disk (see -cache), written once every body requested by the program is compiled.
+// Entries are named by a key from the main script path, script args, -analyze, yov version, layout hash and core.yov, the scripts they were compiled from
+// are checked by content when reading them. Names, strings and paths are used in place, units and values are expanded to resolve their types
+
+#define PROGRAM_CACHE_MAGIC 0x43564F59
+#define PROGRAM_CACHE_VERSION 3
+
+// Types referenced by the cache: no type, Nil, Void, Any and the primitives first, then the program types in order
+#define PROGRAM_CACHE_BUILTIN_TYPES 9
+
+struct ProgramCacheScript {
+    ImageArray path;
+    U64 hash;
+};
+
+struct ProgramCacheType {
+    U32 kind;  // VKind
+    U32 index; // Definition index of structs and enums, element or base type of derived types
+};
+
+struct ProgramCacheValue {
+    U32 kind; // ValueKind
+    U32 type;
+    U64 data;         // Register or literal, type of Type literals
+    ImageArray array; // Values of arrays, compositions and multiple returns, characters of string literals
+};
+
+struct ProgramCacheUnit {
+    U32 kind; // UnitKind
+    U32 line;
+    I32 dst_index;
+    U32 op_dst_type;
+    ProgramCacheValue src0;
+    ProgramCacheValue src1;
+    I32 data[2]; // Function index, jump condition and offset or child is member
+    ImageArray parameters;
+};
+
+struct ProgramCacheRegister {
+    U32 kind; // RegisterKind
+    U32 is_constant;
+    U32 type;
+};
+
+struct ProgramCacheIR {
+    U32 success;
+    U32 parameter_count;
+    ProgramCacheValue value;
+    ImageArray instructions;
+    ImageArray local_registers;
+    ImageArray path;
+};
+
+struct ProgramCacheObject {
+    ImageArray name;
+    U32 type;
+    U32 is_constant;
+    ProgramCacheValue value;
+};
+
+struct ProgramCacheDefinition {
+    U32 type;  // DefinitionType
+    U32 stage; // DefinitionStage, functions never requested by the program stay defined
+    ImageArray identifier;
+    
+    ImageArray objects; // Struct members or function parameters
+    ImageArray returns;
+    ImageArray names;   // Enum names
+    ImageArray values;  // Enum values or struct offsets
+    U32 size;
+    U32 needs_internal_release;
+    U32 is_intrinsic;
+    ProgramCacheIR ir;
+    
+    ImageArray arg_name;
+    ImageArray arg_description;
+    U32 arg_type;
+    U32 arg_required;
+    ProgramCacheValue arg_default_value;
+};
+
+struct ProgramCacheHeader {
+    U32 magic;
+    U32 version;
+    U64 key;
+    U64 size;
+    
+    ImageArray scripts;
+    ImageArray types;
+    ImageArray definitions;
+    ImageArray globals;
+    ProgramCacheIR globals_initialize_ir;
+    U32 front_type_count;
+};
+
 struct FrontContext {
     Arena* arena;
     
@@ -389,26 +615,56 @@ struct FrontContext {
     
     volatile U32 index_counter;
     
-    volatile U32 resolve_count;
-    U32 last_resolve_count;
-    U32 resolve_iterations;
+    TaskGroup script_group;
+    
+    // NOTE(Jose): Resolve scheduling. Types are pushed to the resolve group as soon as their dependencies are ready,
+    // function bodies and args run afterwards as independent tasks, biggest first
+    TaskGroup resolve_group;
+    Array<CodeDefinition*> resolve_codes; // By definition index
+    Array<U32> resolve_pending;
+    Array<U32> resolve_dependents;
+    Array<U32> resolve_dependents_offset;
+    volatile U32 resolve_attempts;
+    Array<F64> resolve_worker_busy_time;
+    
+    // NOTE(Jose): Lazy compilation. Only the bodies reachable from Main, args and global initializers are resolved,
+    // each resolved body requests the functions it calls. Analyze mode resolves everything
+    B32 resolve_all;
+    Array<U32> resolve_requested; // By definition index
+    
+    // NOTE(Jose): Background compilation. Reports of function bodies go to body_reporter,
+    // it is merged into the main reporter once the background bodies are joined
+    Reporter* body_reporter;
+    B32 background_joined;
+    
+    // NOTE(Jose): Core image. The core definitions and globals are the first ones of their lists,
+    // they come identified, defined and resolved (except function bodies) from the image
+    CoreImageHeader* core_image;
+    I32 core_script_id;
+    U32 core_definition_count;
+    U32 core_global_location_count;
 };
 
 YovScript* FrontAddScript(FrontContext* front, String path);
 YovScript* FrontAddCoreScript(FrontContext* front);
+void FrontMapCoreImage(FrontContext* front);
+void FrontWriteCoreImage(FrontContext* front, String path);
+B32 ProgramReadCache(Program* program, Input* input);
+void FrontWriteProgramCache(FrontContext* front);
 YovScript* FrontGetScript(FrontContext* front, I32 script_id);
 U32 LineFromLocation(Location location, YovScript* script);
 
 Parser* ParserFromLocation(FrontContext* front, Location location);
 
-void FrontReadLocationsAndImports(FrontContext* front, YovScript* script, LaneGroup* lane_group);
-void FrontReadAllScripts(LaneContext* lane, FrontContext* front)
-;
-void FrontIdentifyDefinitions(LaneContext* lane, FrontContext* front);
-void FrontDefineDefinitions(LaneContext* lane, FrontContext* front);
-void FrontDefineGlobals(LaneContext* lane, FrontContext* front);
-void FrontResolveGlobals(LaneContext* lane, FrontContext* front);
-void FrontResolveDefinitions(LaneContext* lane, FrontContext* front);
+void FrontReadLocationsAndImports(FrontContext* front, YovScript* script, TaskGroup* group);
+void FrontReadAllScripts(FrontContext* front);
+void FrontIdentifyDefinitions(FrontContext* front);
+void FrontDefineDefinitions(FrontContext* front);
+void FrontDefineGlobals(FrontContext* front);
+void FrontResolveGlobals(FrontContext* front);
+void FrontResolveDefinitions(FrontContext* front);
+void FrontRequestCode(FrontContext* front, U32 index);
+void FrontRequestCalls(FrontContext* front, IR ir);
 
 void FrontDefineEnum(FrontContext* front, CodeDefinition* code);
 void FrontDefineStruct(FrontContext* front, CodeDefinition* code);
@@ -1,4 +1,5 @@
 #include "runtime.h"
+#include "front.h"
 
 //- CORE
 
@@ -222,6 +223,7 @@ void Intrinsic_ArrayRemove(Runtime* runtime, Array<Reference> params, Array<Refe
         return;
     }
     
+    RefArrayMakeUnique(runtime, dst);
     U32 element_size = TypeGetSize(element_type);
     
     ref_release_internal(runtime, ref_get_member(runtime, dst, (U32)index), true);
@@ -257,6 +259,7 @@ void Intrinsic_ArrayUnorderedRemove(Runtime* runtime, Array<Reference> params, A
         return;
     }
     
+    RefArrayMakeUnique(runtime, dst);
     U32 element_size = TypeGetSize(element_type);
     
     ref_release_internal(runtime, ref_get_member(runtime, dst, (U32)index), true);
@@ -272,6 +275,256 @@ void Intrinsic_ArrayUnorderedRemove(Runtime* runtime, Array<Reference> params, A
     dst_array->count--;
 }
 
+internal_fn B32 ArrayKeyTypeIsValid(Type* type)
+{
+    if (type == int_type || type == uint_type || type == float_type || type == bool_type || type == string_type) return true;
+    return TypeIsEnum(type);
+}
+
+internal_fn U64 ArrayKeyFromAddress(Type* type, U8* data)
+{
+    if (type == uint_type) return *(U64*)data;
+    if (type == float_type) return SortKeyFromF64(*(F64*)data);
+    if (type == bool_type) return *(B32*)data != 0;
+    return SortKeyFromI64(*(I64*)data);
+}
+
+internal_fn String ArrayStringKeyFromAddress(U8* data) {
+    ObjectData_String* str = (ObjectData_String*)data;
+    return StrMake(StringDataChars(str), str->size);
+}
+
+internal_fn I32 ArrayKeyCompare(Type* type, U8* d0, U8* d1)
+{
+    if (type == string_type) return StrCompare(ArrayStringKeyFromAddress(d0), ArrayStringKeyFromAddress(d1));
+    
+    U64 k0 = ArrayKeyFromAddress(type, d0);
+    U64 k1 = ArrayKeyFromAddress(type, d1);
+    if (k0 < k1) return -1;
+    if (k0 > k1) return 1;
+    return 0;
+}
+
+// Sorts the elements in place. Keys are extracted once and the elements are moved with a single permutation,
+// the internal memory of each element is moved along with it so nothing is copied or released
+internal_fn void ArraySortInternal(ObjectData_Array* array, U32 element_size, Type* key_type, U32 key_offset, B32 stable)
+{
+    PROFILE_FUNCTION;
+    
+    U32 count = array->count;
+    if (count <= 1) return;
+    
+    ArenaCapture(context.arena);
+    
+    Array<U32> order = ArrayAlloc<U32>(context.arena, count);
+    
+    if (key_type == string_type)
+    {
+        Array<SortKeyStr> keys = ArrayAlloc<SortKeyStr>(context.arena, count);
+        foreach(i, count) {
+            keys[i].key = ArrayStringKeyFromAddress(array->data + (U64)i * element_size + key_offset);
+            keys[i].index = i;
+        }
+        
+        SortStrings(keys, stable);
+        foreach(i, count) order[i] = keys[i].index;
+    }
+    else
+    {
+        // Radix sort is always stable
+        Array<SortKeyU64> keys = ArrayAlloc<SortKeyU64>(context.arena, count);
+        foreach(i, count) {
+            keys[i].key = ArrayKeyFromAddress(key_type, array->data + (U64)i * element_size + key_offset);
+            keys[i].index = i;
+        }
+        
+        SortRadix(context.arena, keys);
+        foreach(i, count) order[i] = keys[i].index;
+    }
+    
+    U64 total_size = (U64)count * element_size;
+    U8* sorted = (U8*)ArenaPush(context.arena, total_size);
+    
+    foreach(i, count) {
+        MemoryCopy(sorted + (U64)i * element_size, array->data + (U64)order[i] * element_size, element_size);
+    }
+    MemoryCopy(array->data, sorted, total_size);
+}
+
+void Intrinsic_ArraySort(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Program* program = runtime->program;
+    
+    if (!TypeIsReference(params[0].type) || !TypeIsArray(TypeGetNext(program, params[0].type))) {
+        ReportErrorRT("First parameter is not an array reference");
+        return;
+    }
+    
+    Type* array_type = TypeGetNext(program, params[0].type);
+    Type* element_type = TypeGetNext(program, array_type);
+    
+    if (!ArrayKeyTypeIsValid(element_type)) {
+        ReportErrorRT("Can't sort an array of '%S', use ArraySortBy for structs", element_type->name);
+        return;
+    }
+    
+    Reference dst = RefDereference(runtime, params[0]);
+    B32 stable = RefGetBool(params[1]);
+    
+    RefArrayMakeUnique(runtime, dst);
+    ArraySortInternal(RefGetArray(dst), TypeGetSize(element_type), element_type, 0, stable);
+}
+
+void Intrinsic_ArraySortBy(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Program* program = runtime->program;
+    
+    if (!TypeIsReference(params[0].type) || !TypeIsArray(TypeGetNext(program, params[0].type))) {
+        ReportErrorRT("First parameter is not an array reference");
+        return;
+    }
+    
+    Type* array_type = TypeGetNext(program, params[0].type);
+    Type* element_type = TypeGetNext(program, array_type);
+    
+    if (!TypeIsStruct(element_type)) {
+        ReportErrorRT("ArraySortBy expects an array of structs, found '%S'", array_type->name);
+        return;
+    }
+    
+    String member_name = get_string(params[1]);
+    B32 stable = RefGetBool(params[2]);
+    
+    // Resolved once per call, the sort itself only works with the member offset
+    VariableTypeChild member = TypeGetMember(element_type, member_name);
+    
+    if (member.index < 0) {
+        ReportErrorRT("Unknown member '%S' in '%S'", member_name, element_type->name);
+        return;
+    }
+    
+    if (!ArrayKeyTypeIsValid(member.type)) {
+        ReportErrorRT("Can't sort by member '%S' of type '%S'", member_name, member.type->name);
+        return;
+    }
+    
+    Reference dst = RefDereference(runtime, params[0]);
+    U32 key_offset = element_type->_struct->offsets[member.index];
+    
+    RefArrayMakeUnique(runtime, dst);
+    ArraySortInternal(RefGetArray(dst), TypeGetSize(element_type), member.type, key_offset, stable);
+}
+
+void Intrinsic_ArrayBinarySearch(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Program* program = runtime->program;
+    
+    Reference array_ref = params[0];
+    if (TypeIsReference(array_ref.type)) array_ref = RefDereference(runtime, array_ref);
+    
+    if (!TypeIsArray(array_ref.type)) {
+        ReportErrorRT("First parameter is not an array");
+        return;
+    }
+    
+    Type* element_type = TypeGetNext(program, array_ref.type);
+    Reference value = params[1];
+    
+    if (value.type != element_type || !ArrayKeyTypeIsValid(element_type)) {
+        ReportErrorRT("Can't search a '%S' in '%S'", value.type->name, array_ref.type->name);
+        return;
+    }
+    
+    ObjectData_Array* array = RefGetArray(array_ref);
+    U32 element_size = TypeGetSize(element_type);
+    U8* key = (U8*)value.address;
+    
+    // Lower bound
+    U32 begin = 0;
+    U32 end = array->count;
+    while (begin < end)
+    {
+        U32 mid = begin + (end - begin) / 2;
+        if (ArrayKeyCompare(element_type, array->data + (U64)mid * element_size, key) < 0) begin = mid + 1;
+        else end = mid;
+    }
+    
+    B32 found = begin < array->count && ArrayKeyCompare(element_type, array->data + (U64)begin * element_size, key) == 0;
+    
+    returns[0] = AllocUInt(runtime, begin);
+    returns[1] = AllocBool(runtime, found);
+}
+
+void Intrinsic_ArrayUnique(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Program* program = runtime->program;
+    
+    if (!TypeIsReference(params[0].type) || !TypeIsArray(TypeGetNext(program, params[0].type))) {
+        ReportErrorRT("First parameter is not an array reference");
+        return;
+    }
+    
+    Type* array_type = TypeGetNext(program, params[0].type);
+    Type* element_type = TypeGetNext(program, array_type);
+    
+    if (!ArrayKeyTypeIsValid(element_type)) {
+        ReportErrorRT("Can't compare elements of '%S'", array_type->name);
+        return;
+    }
+    
+    Reference dst = RefDereference(runtime, params[0]);
+    ObjectData_Array* array = RefGetArray(dst);
+    U32 element_size = TypeGetSize(element_type);
+    
+    if (array->count <= 1) return;
+    RefArrayMakeUnique(runtime, dst);
+    
+    // Removes consecutive duplicates, keeping the first element of each run
+    U32 write = 1;
+    for (U32 read = 1; read < array->count; read++)
+    {
+        U8* prev = array->data + (U64)(write - 1) * element_size;
+        U8* element = array->data + (U64)read * element_size;
+        
+        if (ArrayKeyCompare(element_type, prev, element) == 0) {
+            ref_release_internal(runtime, ref_from_address(dst.parent, element_type, element), true);
+            continue;
+        }
+        
+        if (write != read) {
+            MemoryCopy(array->data + (U64)write * element_size, element, element_size);
+        }
+        write++;
+    }
+    
+    MemoryZero(array->data + (U64)write * element_size, (U64)(array->count - write) * element_size);
+    array->count = write;
+}
+
+void Intrinsic_ArraySlice(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Reference src = params[0];
+    if (TypeIsReference(src.type)) src = RefDereference(runtime, src);
+    
+    if (!TypeIsArray(src.type)) {
+        ReportErrorRT("First parameter is not an array");
+        return;
+    }
+    
+    U64 begin = RefGetUInt(params[1]);
+    U64 end = RefGetUInt(params[2]);
+    U64 count = RefGetArray(src)->count;
+    
+    if (begin > end || end > count) {
+        ReportErrorRT("Slice [%llu..%llu] out of bounds, array count is %llu", begin, end, count);
+        return;
+    }
+    
+    Reference view = object_alloc(runtime, src.type);
+    RefArraySetView(runtime, view, src, (U32)begin, (U32)(end - begin));
+    returns[0] = view;
+}
+
 void Intrinsic_ArrayMakeEmpty(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
 {
     Program* program = runtime->program;
@@ -415,14 +668,84 @@ void Intrinsic_StrSplit(Runtime* runtime, Array<Reference> params, Array<Referen
     
     Array<String> result = StrSplit(context.arena, str, separator);
     
+    // Each piece is a view into the source string
     Reference array = AllocArray(runtime, string_type, result.count);
     foreach(i, result.count) {
-        ref_set_member(runtime, array, i, AllocString(runtime, result[i]));
+        U64 offset = result[i].data - str.data;
+        ref_string_set_view(runtime, ref_get_member(runtime, array, i), params[0], offset, result[i].size);
     }
     
     returns[0] = array;
 }
 
+void Intrinsic_StrFind(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    String pattern = get_string(params[1]);
+    U64 cursor = RefGetUInt(params[2]);
+    
+    U64 index = StrFind(str, pattern, cursor);
+    
+    returns[0] = AllocUInt(runtime, (index == U64_MAX) ? str.size : index);
+    returns[1] = AllocBool(runtime, index != U64_MAX);
+}
+
+void Intrinsic_StrFindLast(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    String pattern = get_string(params[1]);
+    
+    U64 index = StrFindLast(str, pattern);
+    
+    returns[0] = AllocUInt(runtime, (index == U64_MAX) ? str.size : index);
+    returns[1] = AllocBool(runtime, index != U64_MAX);
+}
+
+void Intrinsic_StrContains(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    String pattern = get_string(params[1]);
+    returns[0] = AllocBool(runtime, StrContains(str, pattern));
+}
+
+void Intrinsic_StrCount(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    String pattern = get_string(params[1]);
+    returns[0] = AllocUInt(runtime, StrCount(str, pattern));
+}
+
+void Intrinsic_StrReplace(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    String old_str = get_string(params[1]);
+    String new_str = get_string(params[2]);
+    
+    if (old_str.size == 0) {
+        ReportErrorRT("Can't replace an empty string");
+        return;
+    }
+    
+    returns[0] = AllocString(runtime, StrReplace(context.arena, str, old_str, new_str));
+}
+
+void Intrinsic_StrSlice(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Reference src = params[0];
+    U64 begin = RefGetUInt(params[1]);
+    U64 end = RefGetUInt(params[2]);
+    U64 size = get_string(src).size;
+    
+    if (begin > end || end > size) {
+        ReportErrorRT("Slice [%llu..%llu] out of bounds, string size is %llu", begin, end, size);
+        return;
+    }
+    
+    Reference view = object_alloc(runtime, string_type);
+    ref_string_set_view(runtime, view, src, begin, end - begin);
+    returns[0] = view;
+}
+
 void Intrinsic_StrGetCodepoint(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
 {
     String str = get_string(params[0]);
@@ -434,6 +757,18 @@ void Intrinsic_StrGetCodepoint(Runtime* runtime, Array<Reference> params, Array<
     returns[1] = AllocUInt(runtime, cursor);
 }
 
+void Intrinsic_StrCharCount(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    returns[0] = AllocUInt(runtime, StrCalculateCharCount(str));
+}
+
+void Intrinsic_StrIsUtf8(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    returns[0] = AllocBool(runtime, StrIsValidUtf8(str));
+}
+
 void Intrinsic_StrFromCodepoint(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
 {
     U32 codepoint = (U32)RefGetUInt(params[0]);
@@ -442,6 +777,133 @@ void Intrinsic_StrFromCodepoint(Runtime* runtime, Array<Reference> params, Array
     returns[0] = AllocString(runtime, str);
 }
 
+void Intrinsic_ParseInt(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    
+    I64 value;
+    Result res = RESULT_SUCCESS;
+    if (!I64FromString(&value, str)) {
+        res = ResultMakeFailed(StrFormat(context.arena, "Invalid Int: '%S'", str));
+    }
+    
+    returns[0] = AllocSInt(runtime, value);
+    returns[1] = ref_from_Result(runtime, res);
+}
+
+void Intrinsic_ParseFloat(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String str = get_string(params[0]);
+    
+    F64 value;
+    Result res = RESULT_SUCCESS;
+    if (!F64FromString(&value, str)) {
+        res = ResultMakeFailed(StrFormat(context.arena, "Invalid Float: '%S'", str));
+    }
+    
+    returns[0] = AllocFloat(runtime, value);
+    returns[1] = ref_from_Result(runtime, res);
+}
+
+// NOTE(Jose): The last chunk grows by doubling until it reaches the chunk size, filled chunks are never copied again
+#define STRING_BUILDER_CHUNK_SIZE Kb(64)
+
+internal_fn void StringBuilderAppend(Runtime* runtime, Reference builder, String str)
+{
+    Program* program = runtime->program;
+    
+    if (str.size == 0) return;
+    
+    Reference chunks = ref_get_member(runtime, builder, TypeGetMember(Type_StringBuilder, "chunks").index);
+    Reference size = ref_get_member(runtime, builder, TypeGetMember(Type_StringBuilder, "size").index);
+    ObjectData_Array* array = RefGetArray(chunks);
+    
+    B32 new_chunk = array->count == 0;
+    
+    if (!new_chunk) {
+        U64 last_size = get_string(ref_get_member(runtime, chunks, array->count - 1)).size;
+        new_chunk = last_size + str.size > STRING_BUILDER_CHUNK_SIZE;
+    }
+    
+    if (new_chunk)
+    {
+        U32 capacity = array->count + 1;
+        if (capacity > array->capacity) capacity = Max(capacity, array->capacity * 2);
+        RefArrayPrepare(runtime, chunks, capacity);
+        array->count++;
+        
+        // Spare capacity might hold stale bytes from removed elements
+        *ref_string_get_data(runtime, ref_get_member(runtime, chunks, array->count - 1)) = {};
+    }
+    else {
+        RefArrayMakeUnique(runtime, chunks);
+    }
+    
+    ref_string_append(runtime, ref_get_member(runtime, chunks, array->count - 1), str);
+    RefSetUInt(size, RefGetUInt(size) + str.size);
+}
+
+void Intrinsic_StringBuilderAppend(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Program* program = runtime->program;
+    Assert(TypeIsReference(params[0].type) && TypeGetNext(program, params[0].type) == Type_StringBuilder);
+    
+    Reference builder = RefDereference(runtime, params[0]);
+    if (is_null(builder)) {
+        ReportNullRef();
+        return;
+    }
+    
+    StringBuilderAppend(runtime, builder, get_string(params[1]));
+}
+
+void Intrinsic_StringBuilderAppendLine(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Program* program = runtime->program;
+    Assert(TypeIsReference(params[0].type) && TypeGetNext(program, params[0].type) == Type_StringBuilder);
+    
+    Reference builder = RefDereference(runtime, params[0]);
+    if (is_null(builder)) {
+        ReportNullRef();
+        return;
+    }
+    
+    StringBuilderAppend(runtime, builder, get_string(params[1]));
+    StringBuilderAppend(runtime, builder, "\n");
+}
+
+void Intrinsic_StringBuilderToString(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    Program* program = runtime->program;
+    
+    Reference chunks = ref_get_member(runtime, params[0], TypeGetMember(Type_StringBuilder, "chunks").index);
+    ObjectData_Array* array = RefGetArray(chunks);
+    
+    Reference res = object_alloc(runtime, string_type);
+    
+    // A single chunk is shared instead of copied
+    if (array->count == 1) {
+        RefCopy(runtime, res, ref_get_member(runtime, chunks, 0));
+        returns[0] = res;
+        return;
+    }
+    
+    U64 size = 0;
+    foreach(i, array->count) {
+        size += get_string(ref_get_member(runtime, chunks, i)).size;
+    }
+    
+    ref_string_prepare(runtime, res, size, true);
+    char* dst = StringDataChars(ref_string_get_data(runtime, res));
+    
+    foreach(i, array->count) {
+        String chunk = get_string(ref_get_member(runtime, chunks, i));
+        MemoryCopy(dst, chunk.data, chunk.size);
+        dst += chunk.size;
+    }
+    
+    returns[0] = res;
+}
 
 void Intrinsic_PathAppend(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
 {
@@ -613,6 +1075,14 @@ void Intrinsic_YovParse(Runtime* runtime, Array<Reference> params, Array<Referen
 #endif
 }
 
+void Intrinsic_YovTokenCount(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
+{
+    String source = get_string(params[0]);
+    
+    TokenArray tokens = TokenArrayFromText(context.arena, source, { 0, source.size });
+    returns[0] = AllocUInt(runtime, tokens.count);
+}
+
 //- MISC
 
 void Intrinsic_AskYesNo(Runtime* runtime, Array<Reference> params, Array<Reference> returns)
@@ -821,6 +1291,11 @@ IntrinsicRegistry intrinsics[] = {
     // TODO(Jose): { Intrinsic_ArrayAppendElementFront, "ArrayAppendElementFront" },
     { Intrinsic_ArrayRemove, "ArrayRemove" },
     { Intrinsic_ArrayUnorderedRemove, "ArrayUnorderedRemove" },
+    { Intrinsic_ArraySort, "ArraySort" },
+    { Intrinsic_ArraySortBy, "ArraySortBy" },
+    { Intrinsic_ArrayBinarySearch, "ArrayBinarySearch" },
+    { Intrinsic_ArrayUnique, "ArrayUnique" },
+    { Intrinsic_ArraySlice, "ArraySlice" },
     { Intrinsic_ArrayMakeEmpty, "ArrayMakeEmpty" },
     { Intrinsic_ListMakeEmpty, "ListMakeEmpty" },
     
@@ -837,8 +1312,21 @@ IntrinsicRegistry intrinsics[] = {
     { Intrinsic_StrAppend, "StrAppend" },
     { Intrinsic_StrEquals, "StrEquals" },
     { Intrinsic_StrSplit, "StrSplit" },
+    { Intrinsic_StrSlice, "StrSlice" },
+    { Intrinsic_StrFind, "StrFind" },
+    { Intrinsic_StrFindLast, "StrFindLast" },
+    { Intrinsic_StrContains, "StrContains" },
+    { Intrinsic_StrCount, "StrCount" },
+    { Intrinsic_StrReplace, "StrReplace" },
     { Intrinsic_StrGetCodepoint, "StrGetCodepoint" },
+    { Intrinsic_StrCharCount, "StrCharCount" },
+    { Intrinsic_StrIsUtf8, "StrIsUtf8" },
     { Intrinsic_StrFromCodepoint, "StrFromCodepoint" },
+    { Intrinsic_ParseInt, "ParseInt" },
+    { Intrinsic_ParseFloat, "ParseFloat" },
+    { Intrinsic_StringBuilderAppend, "StringBuilderAppend" },
+    { Intrinsic_StringBuilderAppendLine, "StringBuilderAppendLine" },
+    { Intrinsic_StringBuilderToString, "StringBuilderToString" },
     
     { Intrinsic_PathAppend, "PathAppend" },
     { Intrinsic_PathResolve, "PathResolve" },
@@ -854,6 +1342,7 @@ IntrinsicRegistry intrinsics[] = {
     { Intrinsic_YovRequireMin, "YovRequireMin" },
     { Intrinsic_YovRequireMax, "YovRequireMax" },
     { Intrinsic_YovParse, "YovParse" },
+    { Intrinsic_YovTokenCount, "YovTokenCount" },
     { Intrinsic_AskYesNo, "AskYesNo" },
     
     { Intrinsic_Exists, "Exists" },
@@ -875,10 +1364,28 @@ IntrinsicRegistry intrinsics[] = {
     
 };
 
+IdentifierSlot intrinsic_slots[512];
+IdentifierTable intrinsic_table = { intrinsic_slots, countof(intrinsic_slots) };
+volatile U32 intrinsic_table_ready;
+Mutex intrinsic_table_mutex;
+
+static_assert(countof(intrinsics) * 2 <= countof(intrinsic_slots), "Not enough intrinsic slots");
+
 IntrinsicFunction* IntrinsicFromIdentifier(String identifier)
 {
-    foreach(i, countof(intrinsics)) {
-        if (intrinsics[i].identifier == identifier) return intrinsics[i].fn;
+    if (!intrinsic_table_ready)
+    {
+        MutexLockGuard(&intrinsic_table_mutex);
+        
+        if (!intrinsic_table_ready) {
+            foreach(i, countof(intrinsics)) {
+                IdentifierTableInsert(&intrinsic_table, InternString(intrinsics[i].identifier), i);
+            }
+            AtomicStore32(&intrinsic_table_ready, 1);
+        }
     }
-    return NULL;
+    
+    IdentifierSlot* slot = IdentifierTableFind(&intrinsic_table, InternFind(identifier));
+    if (slot == NULL) return NULL;
+    return intrinsics[slot->index].fn;
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ IR_Unit* IRUnitAlloc(IR_Context* ir, UnitKind kind, Location location)
     unit->kind = kind;
     unit->location = location;
     unit->dst_index = -1;
+    unit->index = -1;
     return unit;
 }
 
@@ -37,8 +38,6 @@ IR_Group IRFailed()
     IR_Group out{};
     out.success = false;
     out.unit_count = 0;
-    out.first = NULL;
-    out.last = NULL;
     out.value = ValueNone();
     return out;
 }
@@ -48,72 +47,113 @@ IR_Group IRFromNone(Value value)
     IR_Group out{};
     out.success = true;
     out.unit_count = 0;
-    out.first = NULL;
-    out.last = NULL;
     out.value = value;
     return out;
 }
 
 IR_Group IRFromSingle(IR_Unit* unit, Value value)
 {
-    Assert(unit->next == NULL && unit->prev == NULL);
     IR_Group out{};
     out.success = true;
     out.value = value;
     out.unit_count = 1;
-    out.first = unit;
-    out.last = unit;
+    out.single = unit;
     return out;
 }
+
+IR_Unit* IRGroupFirst(IR_Group group)
+{
+    if (group.unit_count == 0) return NULL;
+    if (group.single != NULL) return group.single;
+    return group.first->units[0];
+}
+
+IR_Unit* IRGroupLast(IR_Group group)
+{
+    if (group.unit_count == 0) return NULL;
+    if (group.single != NULL) return group.single;
+    return group.last->units[group.last->count - 1];
+}
+
 #if DEV
 internal_fn void DEV_validate_IR_Group(IR_Group out)
 {
     PROFILE_FUNCTION;
+    if (out.single != NULL) {
+        Assert(out.unit_count == 1 && out.first == NULL);
+        return;
+    }
     U32 count = 0;
-    IR_Unit* unit = out.first;
-    while (unit != NULL) {
-        Assert(unit->next != NULL || unit == out.last);
-        unit = unit->next;
-        count++;
+    IR_Segment* segment = out.first;
+    while (segment != NULL) {
+        Assert(segment->count > 0 && segment->count <= IR_SEGMENT_CAPACITY);
+        Assert(segment->next != NULL || segment == out.last);
+        count += segment->count;
+        segment = segment->next;
     }
     Assert(out.unit_count == count);
 }
 #endif
 
+internal_fn void IRGroupPush(IR_Group* group, IR_Unit* unit)
+{
+    if (group->last == NULL || group->last->count == IR_SEGMENT_CAPACITY)
+    {
+        IR_Segment* segment = ArenaPushStruct<IR_Segment>(context.arena);
+        segment->next = NULL;
+        segment->count = 0;
+        
+        if (group->last != NULL) group->last->next = segment;
+        else group->first = segment;
+        group->last = segment;
+    }
+    
+    group->last->units[group->last->count++] = unit;
+    group->unit_count++;
+}
+
 IR_Group IRAppend(IR_Group o0, IR_Group o1)
 {
     PROFILE_FUNCTION;
     
-    IR_Group out = {};
-    out.success = o0.success && o1.success;
-    if (!out.success) return IRFailed();
+    if (!o0.success || !o1.success) return IRFailed();
     
 #if DEV
     DEV_validate_IR_Group(o0);
     DEV_validate_IR_Group(o1);
 #endif
     
-    if (o0.unit_count > 0) {
-        out.first = o0.first;
-    }
-    else if (o1.unit_count > 0) {
-        out.first = o1.first;
+    if (o0.unit_count == 0) return o1;
+    
+    IR_Group out = o0;
+    out.value = o1.value;
+    
+    if (o1.unit_count == 0) return out;
+    
+    if (out.single != NULL) {
+        IR_Unit* unit = out.single;
+        out.single = NULL;
+        out.unit_count = 0;
+        IRGroupPush(&out, unit);
     }
     
-    if (o1.unit_count > 0) {
-        out.last = o1.last;
+    if (o1.single != NULL) {
+        IRGroupPush(&out, o1.single);
     }
-    else if (o0.unit_count > 0) {
-        out.last = o0.last;
+    else if (o1.unit_count <= IR_SEGMENT_CAPACITY - out.last->count)
+    {
+        IR_Segment* segment = o1.first;
+        while (segment != NULL) {
+            foreach(i, segment->count) IRGroupPush(&out, segment->units[i]);
+            segment = segment->next;
+        }
+    }
+    else
+    {
+        out.last->next = o1.first;
+        out.last = o1.last;
+        out.unit_count += o1.unit_count;
     }
-    
-    if (o0.first != NULL) o0.first->prev = NULL;
-    if (o0.last != NULL) o0.last->next = o1.first;
-    if (o1.first != NULL) o1.first->prev = o0.last;
-    if (o1.last != NULL) o1.last->next = NULL;
-    
-    out.unit_count = o0.unit_count + o1.unit_count;
-    out.value = o1.value;
     
 #if DEV
     DEV_validate_IR_Group(out);
@@ -193,6 +233,11 @@ IR_Group IRFromReference(IR_Context* ir, B32 expects_lvalue, Value value, Locati
         return IRFailed();
     }
     
+    // The referenced value can be modified through the reference
+    IRMarkWrite(ir, value);
+    IR_Object* obj = ir_find_object_from_value(ir, value);
+    if (obj != NULL) obj->assignment_count++;
+    
     return IRFromNone(ValueFromReference(program, value));
 }
 
@@ -388,6 +433,29 @@ IR_Group IRFromEmptyList(IR_Context* ir, Type* base_type, Array<Value> dimension
     return IRFailed();
 }
 
+IR_Group IRFromSlice(IR_Context* ir, Value src, Value begin, Value end, Location location)
+{
+    Program* program = ir->program;
+    
+    Array<Value> params = ArrayAlloc<Value>(context.arena, 3);
+    params[0] = src;
+    params[1] = begin;
+    params[2] = end;
+    
+    if (src.type == string_type) {
+        return IRFromFunctionCallName(ir, "StrSlice", params, ExpresionContext_from_type(string_type, 1), location);
+    }
+    
+    IR_Group out = IRFromFunctionCallName(ir, "ArraySlice", params, ExpresionContext_from_type(src.type, 1), location);
+    if (!out.success) return IRFailed();
+    
+    // NOTE(Jose): ArraySlice returns Any, the slice is stored into a temporal with the type of the source array
+    IR_Group dst = IRFromDefineTemporal(ir, src.type, location);
+    out = IRAppend(out, IRFromStore(ir, dst.value, out.value, location));
+    out.value = dst.value;
+    return out;
+}
+
 IR_Group IRFromStore(IR_Context* ir, Value dst, Value src, Location location)
 {
     PROFILE_FUNCTION;
@@ -406,6 +474,7 @@ IR_Group IRFromCopy(IR_Context* ir, Value dst, Value src, Location location)
     PROFILE_FUNCTION;
     
     Assert(dst.kind == ValueKind_LValue || dst.kind == ValueKind_Register);
+    IRMarkWrite(ir, dst);
     
     IR_Unit* unit = IRUnitAlloc(ir, UnitKind_Copy, location);
     unit->dst_index = dst.reg.index;
@@ -426,8 +495,29 @@ IR_Group IRFromAssignment(IR_Context* ir, B32 expects_lvalue, Value dst, Value s
         return IRFailed();
     }
     
+    IRMarkWrite(ir, dst);
+    
     IR_Group out = IRFromNone();
     
+    // String append-to-self grows the destination in place instead of building a temporary
+    if (op == OperatorKind_Addition && src.type == string_type)
+    {
+        B32 dst_is_string = dst.type == string_type;
+        if (TypeIsReference(dst.type) && TypeGetNext(program, dst.type) == string_type) dst_is_string = true;
+        
+        if (dst_is_string)
+        {
+            IR_Object* obj = ir_find_object_from_value(ir, dst);
+            if (obj != NULL) obj->assignment_count++;
+            
+            IR_Unit* unit = IRUnitAlloc(ir, UnitKind_Append, location);
+            unit->dst_index = dst.reg.index;
+            unit->src0 = src;
+            
+            return IRAppend(out, IRFromSingle(unit));
+        }
+    }
+    
     if (op != OperatorKind_None)
     {
         out = IRAppend(out, IRFromBinaryOperator(ir, dst, src, op, true, location));
@@ -940,10 +1030,33 @@ IR_Group IRFromChild(IR_Context* ir, Value src, Value index, B32 is_member, Type
     unit->src1 = index;
     unit->child.child_is_member = is_member;
     
+    ir->register_children[LocalFromRegIndex(ir->program, unit->dst_index)] = unit;
+    
     Value child = ValueFromRegister(unit->dst_index, type, src.kind == ValueKind_LValue);
     return IRFromSingle(unit, child);
 }
 
+// NOTE(Jose): Array elements can live in storage shared with views and copies of views. Every child
+// loaded on the way to a modified value copies that storage first, reads never do.
+// The object the chain starts from counts the write, so a for each can tell when its element alias was modified
+void IRMarkWrite(IR_Context* ir, Value value)
+{
+    while (value.kind == ValueKind_LValue || value.kind == ValueKind_Register)
+    {
+        I32 local_index = LocalFromRegIndex(ir->program, value.reg.index);
+        if (local_index < 0 || local_index >= ir->register_children.count) break;
+        
+        IR_Unit* unit = ir->register_children[local_index];
+        if (unit == NULL) break;
+        
+        unit->child.child_is_write = true;
+        value = unit->src0;
+    }
+    
+    IR_Object* obj = ir_find_object_from_value(ir, value);
+    if (obj != NULL) obj->write_count++;
+}
+
 IR_Group IRFromChildAccess(IR_Context* ir, Value src, String child_name, ExpresionContext expr_context, Location location)
 {
     PROFILE_FUNCTION;
@@ -1041,7 +1154,7 @@ IR_Group IRFromIfStatement(IR_Context* ir, Value condition, IR_Group success, IR
         IR_Unit* jump = IRUnitAlloc_Jump(ir, 0, ValueNone(), end_unit, location);
         success = IRAppend(success, IRFromSingle(jump));
         
-        failed_unit = failure.first;
+        failed_unit = IRGroupFirst(failure);
     }
     
     IR_Unit* jump = IRUnitAlloc_Jump(ir, -1, condition, failed_unit, location);
@@ -1092,7 +1205,7 @@ IR_Group IRFromLoop(IR_Context* ir, IR_Group init, IR_Group condition, IR_Group
             condition = IRAppend(condition, IRFromSingle(IRUnitAlloc_Empty(ir, location)));
         }
         
-        IR_Unit* jump = IRUnitAlloc_Jump(ir, 0, ValueNone(), condition.first, location);
+        IR_Unit* jump = IRUnitAlloc_Jump(ir, 0, ValueNone(), IRGroupFirst(condition), location);
         content = IRAppend(content, IRFromSingle(jump));
     }
     
@@ -1337,6 +1450,7 @@ internal_fn Unit UnitMake(Arena* arena, IR_Unit* unit)
     }
     else if (kind == UnitKind_Child) {
         dst.child.child_is_member = unit->child.child_is_member;
+        dst.child.child_is_write = unit->child.child_is_write;
     }
     
     return dst;
@@ -1346,62 +1460,56 @@ IR MakeIR(Arena* arena, Program* program, Array<Register> local_registers, IR_Gr
 {
     PROFILE_FUNCTION;
     
-    Array<IR_Unit*> units = ArrayAlloc<IR_Unit*>(context.arena, group.unit_count);
+    // NOTE(Jose): Each unit takes the index of the next emitted instruction, so jumps to empty units land
+    // on the instruction that follows them
+    Array<Unit> instructions = ArrayAlloc<Unit>(context.arena, group.unit_count + 1);
+    Array<IR_Unit*> sources = ArrayAlloc<IR_Unit*>(context.arena, group.unit_count);
+    instructions.count = 0;
+    sources.count = 0;
+    
     {
-        IR_Unit* unit = group.first;
-        foreach(i, units.count) {
-            if (unit == NULL) {
-                InvalidCodepath();
-                units.count = i;
-                break;
+        IR_Segment single_segment = {};
+        IR_Segment* segment = group.first;
+        
+        if (group.single != NULL) {
+            single_segment.count = 1;
+            single_segment.units[0] = group.single;
+            segment = &single_segment;
+        }
+        
+        while (segment != NULL)
+        {
+            foreach(i, segment->count)
+            {
+                IR_Unit* unit = segment->units[i];
+                unit->index = instructions.count;
+                
+                Unit instr = UnitMake(arena, unit);
+                if (instr.kind == UnitKind_Error) continue;
+                
+                sources.data[sources.count++] = unit;
+                instructions.data[instructions.count++] = instr;
             }
-            units[i] = unit;
-            unit = unit->next;
+            segment = segment->next;
         }
     }
     
-    BArray<Unit> instructions = BArrayMake<Unit>(context.arena, 64);
-    BArray<U32> mapping = BArrayMake<U32>(context.arena, 64);
-    
-    foreach(i, units.count) {
-        Unit instr = UnitMake(arena, units[i]);
-        if (instr.kind == UnitKind_Error) continue;
-        BArrayAdd(&instructions, instr);
-        BArrayAdd(&mapping, i);
-    }
-    BArrayAdd(&mapping, units.count);
-    
     // Resolve jump offsets
-    foreach_BArray(it, &instructions)
+    foreach(i, instructions.count)
     {
-        Unit* rt = it.value;
+        Unit* rt = &instructions[i];
         if (rt->kind != UnitKind_Jump) continue;
         
-        IR_Unit* ir = units[mapping[it.index]];
-        
-        I32 ir_index = -1;
-        foreach(i, units.count) {
-            if (units[i] == ir->jump.unit) {
-                ir_index = i;
-                break;
-            }
-        }
-        
-        I32 jump_index = -1;
-        foreach_BArray(it, &mapping)
-        {
-            jump_index = it.index;
-            U32 v = *it.value;
-            if (v >= ir_index) break;
-        }
+        IR_Unit* ir = sources[i];
+        I32 jump_index = ir->jump.unit->index;
         
-        if (ir_index < 0 || jump_index < 0) {
+        if (jump_index < 0) {
             InvalidCodepath();
             *rt = {};
             continue;
         }
         
-        rt->jump.offset = jump_index - (I32)it.index - 1;
+        rt->jump.offset = jump_index - (I32)i - 1;
     }
     
     String ir_debug_path = {};
@@ -1412,12 +1520,8 @@ IR MakeIR(Arena* arena, Program* program, Array<Register> local_registers, IR_Gr
         ir_debug_path = StrCopy(arena, script->path);
         
         // Calculate lines
-        foreach(i, instructions.count)
-        {
-            IR_Unit* unit0 = units[mapping[i]];
-            Unit* unit = &instructions[i];
-            
-            unit->line = LineFromLocation(unit0->location, script);
+        foreach(i, instructions.count) {
+            instructions[i].line = LineFromLocation(sources[i]->location, script);
         }
     }
     
@@ -1431,14 +1535,14 @@ IR MakeIR(Arena* arena, Program* program, Array<Register> local_registers, IR_Gr
             ret.line = instructions[instructions.count - 1].line + 1;
         }
         
-        BArrayAdd(&instructions, ret);
+        instructions.data[instructions.count++] = ret;
     }
     
     IR ir = {};
     ir.success = group.success;
     ir.value = group.value;
     ir.local_registers = ArrayCopy(arena, local_registers);
-    ir.instructions = ArrayFromBArray(arena, instructions);
+    ir.instructions = ArrayCopy(arena, instructions);
     
     ir.path = ir_debug_path;
     
@@ -1484,6 +1588,8 @@ IR_Context* IrContextAlloc(Program* program, Reporter* reporter)
     ir->program = program;
     ir->local_registers = BArrayMake<Register>(ir->arena, 16);
     ir->objects = BArrayMake<IR_Object>(ir->arena, 32);
+    ir->register_objects = BArrayMake<I32>(ir->arena, 16);
+    ir->register_children = BArrayMake<IR_Unit*>(ir->arena, 16);
     ir->looping_scopes = BArrayMake<IR_LoopingScope>(ir->arena, 8);
     ir->scope = 0;
     return ir;
@@ -1658,18 +1764,72 @@ B32 IRValidateReturnPath(Array<Unit> units)
     }
 }
 
+internal_fn IR_ObjectSlot* ir_object_slot(IR_ObjectTable* table, U32 identifier_id)
+{
+    U32 slot_index = (identifier_id * 2654435761u) & (table->capacity - 1);
+    
+    while (true)
+    {
+        IR_ObjectSlot* slot = &table->slots[slot_index];
+        if (slot->identifier_id == identifier_id || slot->identifier_id == 0) return slot;
+        slot_index = (slot_index + 1) & (table->capacity - 1);
+    }
+}
+
+internal_fn void ir_object_table_set(IR_Context* ir, U32 identifier_id, I32 object_index)
+{
+    IR_ObjectTable* table = &ir->object_table;
+    
+    if ((table->count + 1) * 2 > table->capacity)
+    {
+        IR_ObjectTable old = *table;
+        
+        table->capacity = Max(old.capacity * 2, 32u);
+        table->slots = ArenaPushStruct<IR_ObjectSlot>(ir->arena, table->capacity);
+        MemoryZero(table->slots, sizeof(IR_ObjectSlot) * table->capacity);
+        
+        foreach(i, old.capacity) {
+            IR_ObjectSlot src = old.slots[i];
+            if (src.identifier_id != 0) *ir_object_slot(table, src.identifier_id) = src;
+        }
+    }
+    
+    IR_ObjectSlot* slot = ir_object_slot(table, identifier_id);
+    if (slot->identifier_id == 0) {
+        slot->identifier_id = identifier_id;
+        table->count++;
+    }
+    slot->object_index = object_index;
+}
+
+internal_fn I32 ir_object_table_get(IR_Context* ir, U32 identifier_id)
+{
+    IR_ObjectTable* table = &ir->object_table;
+    if (table->capacity == 0) return -1;
+    
+    IR_ObjectSlot* slot = ir_object_slot(table, identifier_id);
+    if (slot->identifier_id == 0) return -1;
+    return slot->object_index;
+}
+
 IR_Object* ir_find_object(IR_Context* ir, String identifier, B32 parent_scopes)
 {
-    IR_Object* res = NULL;
+    U32 identifier_id = InternFind(identifier);
+    if (identifier_id == 0) return NULL;
+    
+    I32 object_index = ir_object_table_get(ir, identifier_id);
+    if (object_index < 0) return NULL;
     
-    foreach_BArray(it, &ir->objects) {
-        IR_Object* obj = it.value;
-        if (!parent_scopes && obj->scope != ir->scope) continue;
-        if (!StrEquals(obj->identifier, identifier)) continue;
-        if (res != NULL && res->scope >= obj->scope) continue;
-        res = obj;
+    // NOTE(Jose): Objects of the same scope don't shadow each other, the first one wins
+    IR_Object* res = &ir->objects[object_index];
+    while (res->shadowed_index >= 0)
+    {
+        IR_Object* prev = &ir->objects[res->shadowed_index];
+        if (prev->scope != res->scope) break;
+        res = prev;
     }
     
+    if (!parent_scopes && res->scope != ir->scope) return NULL;
     return res;
 }
 
@@ -1684,23 +1844,42 @@ IR_Object* ir_find_object_from_value(IR_Context* ir, Value value)
 
 IR_Object* ir_find_object_from_register(IR_Context* ir, I32 register_index)
 {
-    foreach_BArray(it, &ir->objects) {
-        IR_Object* obj = it.value;
-        if (obj->register_index != register_index) continue;
-        return obj;
+    I32 local_index = LocalFromRegIndex(ir->program, register_index);
+    if (local_index < 0 || local_index >= ir->register_objects.count) return NULL;
+    
+    I32 object_index = ir->register_objects[local_index];
+    if (object_index < 0) return NULL;
+    return &ir->objects[object_index];
+}
+
+internal_fn IR_Object* ir_push_object(IR_Context* ir, U32 identifier_id, I32 register_index, I32 scope)
+{
+    Assert(ir->objects.count == 0 || ir->objects[ir->objects.count - 1].scope <= scope);
+    
+    I32 object_index = ir->objects.count;
+    IR_Object* def = BArrayAdd(&ir->objects);
+    def->identifier_id = identifier_id;
+    def->register_index = register_index;
+    def->scope = scope;
+    def->shadowed_index = ir_object_table_get(ir, identifier_id);
+    
+    ir_object_table_set(ir, identifier_id, object_index);
+    
+    I32 local_index = LocalFromRegIndex(ir->program, register_index);
+    if (local_index >= 0 && local_index < ir->register_objects.count && ir->register_objects[local_index] < 0) {
+        ir->register_objects[local_index] = object_index;
     }
-    return NULL;
+    
+    return def;
 }
 
 IR_Object* ir_define_object(IR_Context* ir, String identifier, Type* type, I32 scope, I32 register_index)
 {
     Assert(scope != ir->scope || ir_find_object(ir, identifier, false) == NULL);
     
-    IR_Object* def = BArrayAdd(&ir->objects);
+    IR_Object* def = ir_push_object(ir, InternString(identifier), register_index, scope);
     def->identifier = StrCopy(ir->arena, identifier);
     def->type = type;
-    def->register_index = register_index;
-    def->scope = scope;
     return def;
 }
 
@@ -1708,11 +1887,11 @@ IR_Object* ir_assume_object(IR_Context* ir, IR_Object* object, Type* type)
 {
     Assert(IRRegisterGet(ir, object->register_index).type == any_type);
     
-    IR_Object* def = BArrayAdd(&ir->objects);
-    def->identifier = object->identifier;
+    String identifier = object->identifier;
+    
+    IR_Object* def = ir_push_object(ir, object->identifier_id, object->register_index, ir->scope);
+    def->identifier = identifier;
     def->type = type;
-    def->register_index = object->register_index;
-    def->scope = ir->scope;
     return def;
 }
 
@@ -1790,11 +1969,20 @@ void ir_scope_pop(IR_Context* ir)
     ir->scope--;
     Assert(ir->scope >= 0);
     
-    for (I32 i = (I32)ir->objects.count - 1; i >= 0; --i)
+    while (ir->objects.count > 0)
     {
-        if (ir->objects[i].scope > ir->scope) {
-            BArrayErase(&ir->objects, i);
+        I32 object_index = ir->objects.count - 1;
+        IR_Object* obj = &ir->objects[object_index];
+        if (obj->scope <= ir->scope) break;
+        
+        ir_object_table_set(ir, obj->identifier_id, obj->shadowed_index);
+        
+        I32 local_index = LocalFromRegIndex(ir->program, obj->register_index);
+        if (local_index >= 0 && local_index < ir->register_objects.count && ir->register_objects[local_index] == object_index) {
+            ir->register_objects[local_index] = -1;
         }
+        
+        BArrayErase(&ir->objects, object_index);
     }
 }
 
@@ -1804,6 +1992,8 @@ I32 IRRegisterAlloc(IR_Context* ir, Type* type, RegisterKind kind, B32 constant)
     Assert(kind != RegisterKind_None);
     U32 local_index = ir->local_registers.count;
     Register* reg = BArrayAdd(&ir->local_registers);
+    BArrayAdd(&ir->register_objects, -1);
+    BArrayAdd(&ir->register_children, (IR_Unit*)NULL);
     reg->type = type;
     reg->kind = kind;
     reg->is_constant = constant;
@@ -22,6 +22,8 @@ I64 CompileAndRunFromArgs()
         ExecuteProgram(program, reporter, settings);
     }
     
+    ProgramFinishCompilation(program);
+    
     ReporterPrint(reporter);
     
     if (input->settings.wait_end) {
@@ -85,6 +87,8 @@ I64 CompileAndDebugFromArgs()
         RuntimeFree(runtime);
     }
     
+    ProgramFinishCompilation(program);
+    
     ReporterPrint(reporter);
     
     if (input->settings.wait_end) {
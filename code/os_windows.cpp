@@ -81,6 +81,7 @@ void SetupGlobals()
 
 void ShutdownGlobals()
 {
+    TaskPoolShutdown();
     ShutdownThread();
     
     SetConsoleMode(GetStdHandle(STD_INPUT_HANDLE), stdin_default_mode);
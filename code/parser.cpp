@@ -1,6 +1,39 @@
 #include "front.h"
 
-Parser* ParserAlloc(YovScript* script, RangeU64 range)
+internal_fn U32 TokenIndexFromCursor(TokenArray* tokens, U64 cursor)
+{
+    U32 low = 0;
+    U32 high = tokens->count;
+    
+    while (low < high)
+    {
+        U32 mid = low + (high - low) / 2;
+        if (tokens->starts[mid] < cursor) low = mid + 1;
+        else high = mid;
+    }
+    
+    return low;
+}
+
+inline_fn U64 TokenEndFromIndex(TokenArray* tokens, U32 index) {
+    return (U64)tokens->starts[index] + tokens->lengths[index];
+}
+
+internal_fn B32 TokenArrayContainsRange(TokenArray* tokens, RangeU64 range, U32* first, U32* end)
+{
+    if (tokens->count == 0 || range.min < tokens->range.min || range.max > tokens->range.max) return false;
+    
+    *first = TokenIndexFromCursor(tokens, range.min);
+    *end = TokenIndexFromCursor(tokens, range.max);
+    
+    // Ranges cutting a token can't reuse these tokens
+    if (*first > 0 && TokenEndFromIndex(tokens, *first - 1) > range.min) return false;
+    if (*end > 0 && TokenEndFromIndex(tokens, *end - 1) > range.max) return false;
+    
+    return true;
+}
+
+internal_fn Parser* ParserAllocWithTokens(YovScript* script, TokenArray* tokens, RangeU64 range)
 {
     Parser* parser = ArenaPushStruct<Parser>(context.arena);
     parser->script = script;
@@ -9,6 +42,27 @@ Parser* ParserAlloc(YovScript* script, RangeU64 range)
     parser->cursor = range.min;
     parser->range = range;
     
+    if (script != NULL)
+    {
+        U32 first, end;
+        if (tokens == NULL || !TokenArrayContainsRange(tokens, range, &first, &end))
+        {
+            // NOTE(Jose): Expressions inside string literals are not part of the script tokens
+            tokens = ArenaPushStruct<TokenArray>(context.arena);
+            *tokens = TokenArrayFromText(context.arena, parser->text, range);
+            first = 0;
+            end = tokens->count;
+        }
+        
+        parser->tokens = tokens;
+        parser->token_index = first;
+        parser->token_end = end;
+    }
+    else
+    {
+        parser->tokens = ArenaPushStruct<TokenArray>(context.arena);
+    }
+
 #if DEV
     parser->debug_str = StrHeapCopy(StrSub(parser->text, parser->range.min, parser->range.max - parser->range.min));
 #endif
@@ -16,11 +70,17 @@ Parser* ParserAlloc(YovScript* script, RangeU64 range)
     return parser;
 }
 
+Parser* ParserAlloc(YovScript* script, RangeU64 range)
+{
+    TokenArray* tokens = (script != NULL) ? &script->tokens : NULL;
+    return ParserAllocWithTokens(script, tokens, range);
+}
+
 Parser* ParserSub(Parser* parser, Location location)
 {
     if (parser->script == NULL) return ParserAlloc(NULL, {});
     Assert(parser->script->id == location.script_id);
-    return ParserAlloc(parser->script, location.range);
+    return ParserAllocWithTokens(parser->script, parser->tokens, location.range);
 }
 
 Location LocationFromParser(Parser* parser, U64 end) {
@@ -29,9 +89,55 @@ Location LocationFromParser(Parser* parser, U64 end) {
     return LocationMake(parser->cursor, end, parser->script_id);
 }
 
-Token PeekToken(Parser* parser, I64 cursor_offset)
+// Cursor where the token at the index starts, including the invalid tokens skipped before it
+internal_fn U64 TokenCursorFromIndex(Parser* parser, U32 index)
 {
-    Token token = ReadValidToken(parser->text, parser->cursor + cursor_offset, parser->range.max, parser->script_id);
+    if (index <= parser->token_index) return parser->cursor;
+    return TokenEndFromIndex(parser->tokens, index - 1);
+}
+
+internal_fn OperatorKind AssignmentOperatorFromChar(char c)
+{
+    if (c == '+') return OperatorKind_Addition;
+    if (c == '-') return OperatorKind_Substraction;
+    if (c == '*') return OperatorKind_Multiplication;
+    if (c == '/') return OperatorKind_Division;
+    if (c == '%') return OperatorKind_Modulo;
+    return OperatorKind_None;
+}
+
+Token PeekToken(Parser* parser, U32 token_offset)
+{
+    TokenArray* tokens = parser->tokens;
+    U64 index = (U64)parser->token_index + token_offset;
+    U64 cursor = TokenCursorFromIndex(parser, (U32)Min(index, (U64)parser->token_end));
+    
+    Token token{};
+    token.cursor = cursor;
+    
+    if (index >= parser->token_end) {
+        token.kind = TokenKind_None;
+        token.skip_size = (cursor < parser->range.max) ? (U32)(parser->range.max - cursor) : 0;
+        return token;
+    }
+    
+    U64 start = tokens->starts[index];
+    U64 size = tokens->lengths[index];
+    
+    token.kind = (TokenKind)tokens->kinds[index];
+    token.value = StrSub(parser->text, start, size);
+    token.location = LocationMake(start, start + size, parser->script_id);
+    token.skip_size = (U32)(start + size - cursor);
+    
+    // Discard double quotes
+    if (token.kind == TokenKind_StringLiteral) {
+        token.value = StrSub(token.value, 1, token.value.size - 2);
+    }
+    
+    if (token.kind == TokenKind_Assignment) {
+        token.assignment_operator = AssignmentOperatorFromChar(token.value[0]);
+    }
+    
     return token;
 }
 
@@ -39,6 +145,7 @@ void SkipToken(Parser* parser, Token token)
 {
     Assert(parser->cursor == token.cursor);
     parser->cursor += token.skip_size;
+    if (token.kind != TokenKind_None) parser->token_index++;
     Assert(parser->range.max == 0 || parser->cursor <= parser->range.max);
 }
 
@@ -61,6 +168,7 @@ void MoveCursor(Parser* parser, U64 cursor)
     }
     
     parser->cursor = cursor;
+    parser->token_index = Min(TokenIndexFromCursor(parser->tokens, cursor), parser->token_end);
 }
 
 Token ConsumeToken(Parser* parser)
@@ -86,99 +194,75 @@ Array<Token> ConsumeAllTokens(Parser* parser)
 
 void SkipInvalidTokens(Parser* parser)
 {
-    while (1)
-    {
-        Token token = ReadToken(parser->text, parser->cursor, parser->script_id);
-        if (TokenIsValid(token.kind)) break;
-        parser->cursor += token.skip_size;
-    }
+    TokenArray* tokens = parser->tokens;
+    U32 index = TokenIndexFromCursor(tokens, parser->cursor);
+    
+    if (index < tokens->count) parser->cursor = tokens->starts[index];
+    else parser->cursor = Max(parser->cursor, tokens->range.max);
 }
 
 Location FindUntil(Parser* parser, B32 include_match, TokenKind match0, TokenKind match1)
 {
-    U64 offset = 0;
+    TokenArray* tokens = parser->tokens;
     
-    Token token;
-    while (true)
+    for (U32 i = parser->token_index; i < parser->token_end; ++i)
     {
-        token = PeekToken(parser, offset);
-        if (token.kind == TokenKind_None) return NO_CODE;
+        TokenKind kind = (TokenKind)tokens->kinds[i];
+        if (kind != match0 && kind != match1) continue;
         
-        if (token.kind == match0) break;
-        if (token.kind == match1) break;
-        offset += token.skip_size;
+        U64 end = include_match ? TokenEndFromIndex(tokens, i) : TokenCursorFromIndex(parser, i);
+        return LocationFromParser(parser, end);
     }
     
-    if (include_match) {
-        offset += token.skip_size;
-    }
-    
-    return LocationFromParser(parser, parser->cursor + offset);
+    return NO_CODE;
 }
 
 U64 find_token_with_depth_check(Parser* parser, B32 parenthesis, B32 braces, B32 brackets, TokenKind match0, TokenKind match1)
 {
-    U64 offset = 0;
+    TokenArray* tokens = parser->tokens;
     
     I32 depth = 0;
     
-    while (true)
+    for (U32 i = parser->token_index; i < parser->token_end; ++i)
     {
-        Token token = PeekToken(parser, offset);
-        if (token.kind == TokenKind_None) return parser->cursor;
+        TokenKind kind = (TokenKind)tokens->kinds[i];
         
-        if (parenthesis && token.kind == TokenKind_OpenParenthesis) depth++;
-        if (parenthesis && token.kind == TokenKind_CloseParenthesis) depth--;
-        if (braces && token.kind == TokenKind_OpenBrace) depth++;
-        if (braces && token.kind == TokenKind_CloseBrace) depth--;
-        if (brackets && token.kind == TokenKind_OpenBracket) depth++;
-        if (brackets && token.kind == TokenKind_CloseBracket) depth--;
+        if (parenthesis && kind == TokenKind_OpenParenthesis) depth++;
+        if (parenthesis && kind == TokenKind_CloseParenthesis) depth--;
+        if (braces && kind == TokenKind_OpenBrace) depth++;
+        if (braces && kind == TokenKind_CloseBrace) depth--;
+        if (brackets && kind == TokenKind_OpenBracket) depth++;
+        if (brackets && kind == TokenKind_CloseBracket) depth--;
         
         if (depth == 0) {
-            if (token.kind == match0) break;
-            if (token.kind == match1) break;
+            if (kind == match0) return TokenCursorFromIndex(parser, i);
+            if (kind == match1) return TokenCursorFromIndex(parser, i);
         }
-        offset += token.skip_size;
     }
     
-    return parser->cursor + offset;
+    return parser->cursor;
 }
 
 Location FindScope(Parser* parser, TokenKind open_token, B32 include_delimiters)
 {
-    TokenKind close_token = TokenKindFromOpenScope(open_token);
+    TokenArray* tokens = parser->tokens;
+    U32 open_index = parser->token_index;
     
-    U64 offset = 0;
-    I32 depth = 0;
-    
-    Token token = PeekToken(parser);
-    
-    if (token.kind != open_token) {
+    if (open_index >= parser->token_end || tokens->kinds[open_index] != open_token) {
         return NO_CODE;
     }
     
-    while (true)
-    {
-        if (token.kind == TokenKind_None) return NO_CODE;
-        
-        if (token.kind == open_token) depth++;
-        else if (token.kind == close_token) {
-            depth--;
-            if (depth == 0) break;
-        }
-        
-        offset += token.skip_size;
-        token = PeekToken(parser, offset);
+    U32 close_index = tokens->matches[open_index];
+    if (close_index >= parser->token_end) {
+        return NO_CODE;
     }
     
     U64 begin = parser->cursor;
-    if (!include_delimiters) {
-        begin += PeekToken(parser).skip_size;
-    }
+    U64 end = TokenEndFromIndex(tokens, close_index);
     
-    U64 end = parser->cursor + offset;
-    if (include_delimiters) {
-        end += token.skip_size;
+    if (!include_delimiters) {
+        begin = TokenEndFromIndex(tokens, open_index);
+        end = TokenEndFromIndex(tokens, close_index - 1);
     }
     
     return LocationMake(begin, end, parser->script_id);
@@ -1029,6 +1113,68 @@ IR_Group ReadExpression(IR_Context* ir, Parser* parser, ExpresionContext expr_co
                 Array<Token> src_tokens = ArraySub(tokens, 0, starting_token);
                 Array<Token> index_tokens = ArraySub(tokens, starting_token + 1, tokens.count - starting_token - 2);
                 
+                I32 range_index = -1;
+                {
+                    I32 depth = 0;
+                    foreach(i, index_tokens.count) {
+                        TokenKind t = index_tokens[i].kind;
+                        if (t == TokenKind_OpenParenthesis || t == TokenKind_OpenBracket) depth++;
+                        else if (t == TokenKind_CloseParenthesis || t == TokenKind_CloseBracket) depth--;
+                        else if (t == TokenKind_Range && depth == 0) {
+                            range_index = i;
+                            break;
+                        }
+                    }
+                }
+                
+                // Slicing
+                if (src_tokens.count > 0 && range_index >= 0)
+                {
+                    Array<Token> begin_tokens = ArraySub(index_tokens, 0, range_index);
+                    Array<Token> end_tokens = ArraySub(index_tokens, range_index + 1, index_tokens.count - (range_index + 1));
+                    
+                    IR_Group out = ReadExpression(ir, ParserSub(parser, LocationFromTokens(src_tokens)), ExpresionContext_from_void());
+                    if (!out.success) return IRFailed();
+                    
+                    Value src = out.value;
+                    
+                    if (src.type != string_type && !TypeIsArray(src.type)) {
+                        ReportErrorFront(location, "Slicing is only allowed for strings and arrays, found '%S'", src.type->name);
+                        return IRFailed();
+                    }
+                    
+                    Value begin = ValueFromZero(uint_type);
+                    Value end;
+                    
+                    if (begin_tokens.count > 0) {
+                        IR_Group begin_group = ReadExpressionWithCasting(ir, ParserSub(parser, LocationFromTokens(begin_tokens)), ExpresionContext_from_type(uint_type, 1));
+                        if (!begin_group.success) return IRFailed();
+                        out = IRAppend(out, begin_group);
+                        begin = begin_group.value;
+                    }
+                    
+                    // Open ranges end at the size or count property
+                    if (end_tokens.count > 0) {
+                        IR_Group end_group = ReadExpressionWithCasting(ir, ParserSub(parser, LocationFromTokens(end_tokens)), ExpresionContext_from_type(uint_type, 1));
+                        if (!end_group.success) return IRFailed();
+                        out = IRAppend(out, end_group);
+                        end = end_group.value;
+                    }
+                    else {
+                        IR_Group end_group = IRFromChild(ir, src, ValueFromZero(uint_type), false, uint_type, location);
+                        out = IRAppend(out, end_group);
+                        end = end_group.value;
+                    }
+                    
+                    if (begin.type != uint_type || end.type != uint_type) {
+                        report_indexing_expects_an_int(location);
+                        return IRFailed();
+                    }
+                    
+                    out = IRAppend(out, IRFromSlice(ir, src, begin, end, location));
+                    return out;
+                }
+                
                 if (src_tokens.count > 0 && index_tokens.count > 0)
                 {
                     Location src_location = LocationFromTokens(src_tokens);
@@ -1257,7 +1403,7 @@ IR_Group ReadCode(IR_Context* ir, Parser* parser)
                 IR_Group expression = ReadExpressionWithCasting(ir, ParserSub(parser, expression_location), ExpresionContext_from_type(bool_type, 1));
                 if (!expression.success) return IRFailed();
                 
-                CheckForAnyAssumptions(ir, expression.last, expression.value);
+                CheckForAnyAssumptions(ir, IRGroupLast(expression), expression.value);
                 
                 out = IRAppend(out, expression);
                 
@@ -1316,7 +1462,7 @@ IR_Group ReadCode(IR_Context* ir, Parser* parser)
             IR_Group expression = ReadExpressionWithCasting(ir, ParserSub(parser, expression_location), ExpresionContext_from_type(bool_type, 1));
             if (!expression.success) return IRFailed();
             
-            CheckForAnyAssumptions(ir, expression.last, expression.value);
+            CheckForAnyAssumptions(ir, IRGroupLast(expression), expression.value);
             
             Location code_location = FetchCode(parser);
             
@@ -1453,9 +1599,22 @@ IR_Group ReadCode(IR_Context* ir, Parser* parser)
                 
                 // Content code
                 IR_Group content = IRFromChild(ir, iterator.value, index_value, true, element_type, location);
+                Value content_element = content.value;
                 content = IRAppend(content, IRFromStore(ir, element_value, content.value, location));
+                
+                IR_Object* element_object = ir_find_object_from_value(ir, element_value);
+                U32 element_assignment_count = (element_object != NULL) ? element_object->assignment_count : 0;
+                U32 element_write_count = (element_object != NULL) ? element_object->write_count : 0;
+                
                 content = IRAppend(content, ReadCode(ir, ParserSub(parser, content_location)));
                 
+                // The element is an alias, assigning it or storing through its members modifies the iterated array
+                if (element_object != NULL) {
+                    B32 assigned = element_object->assignment_count != element_assignment_count;
+                    B32 written = element_object->write_count != element_write_count;
+                    if (assigned || written) IRMarkWrite(ir, content_element);
+                }
+                
                 // Update code
                 IR_Group update = IRFromAssignment(ir, false, index_value, ValueFromUInt(1), OperatorKind_Addition, location);
                 
@@ -1534,6 +1693,53 @@ IR_Group ReadCode(IR_Context* ir, Parser* parser)
     return out;
 }
 
+// NOTE(Jose): Detects "a = a + ..." so it can be lowered as "a += ...". On success the cursor is moved after the "+".
+// The rest must be a single operand: '+' is left associative and String + Int appends a codepoint, so "a = a + x + y" is not "a += (x + y)"
+internal_fn B32 ReadSelfAppend(Parser* parser, Location dst_code)
+{
+    Array<Token> dst_tokens = ConsumeAllTokens(ParserSub(parser, dst_code));
+    if (dst_tokens.count == 0) return false;
+    
+    Parser* src_parser = ParserSub(parser, LocationFromParser(parser));
+    
+    foreach(i, dst_tokens.count) {
+        Token token = ConsumeToken(src_parser);
+        if (token.kind != dst_tokens[i].kind || !StrEquals(token.value, dst_tokens[i].value)) return false;
+    }
+    
+    Token left_token = ConsumeToken(src_parser);
+    if (left_token.kind != TokenKind_PlusSign) return false;
+    
+    U64 append_cursor = src_parser->cursor;
+    I32 depth = 0;
+    U32 count = 0;
+    
+    while (true)
+    {
+        Token token = ConsumeToken(src_parser);
+        if (token.kind == TokenKind_None) break;
+        count++;
+        
+        if (token.kind == TokenKind_OpenParenthesis || token.kind == TokenKind_OpenBracket || token.kind == TokenKind_OpenBrace) depth++;
+        else if (token.kind == TokenKind_CloseParenthesis || token.kind == TokenKind_CloseBracket || token.kind == TokenKind_CloseBrace) depth--;
+        else if (depth == 0)
+        {
+            if (token.kind == TokenKind_IfKeyword) return false;
+            
+            B32 is_sign = token_is_sign_or_binary_op(left_token.kind) || left_token.kind == TokenKind_OpenParenthesis;
+            
+            if (token_is_sign_or_binary_op(token.kind) && !is_sign) return false;
+        }
+        
+        left_token = token;
+    }
+    
+    if (count == 0) return false;
+    
+    MoveCursor(parser, append_cursor);
+    return true;
+}
+
 IR_Group ReadSentence(IR_Context* ir, Parser* parser)
 {
     PROFILE_FUNCTION;
@@ -1591,6 +1797,10 @@ IR_Group ReadSentence(IR_Context* ir, Parser* parser)
         
         OperatorKind op = assignment_token.assignment_operator;
         
+        if (op == OperatorKind_None && values.count == 1 && values[0].type == string_type) {
+            if (ReadSelfAppend(parser, dst_code)) op = OperatorKind_Addition;
+        }
+        
         IR_Group src;
         {
             
@@ -1863,7 +2073,7 @@ IR_Group ReadFunctionCall(IR_Context* ir, ExpresionContext expr_context, Parser*
     String identifier = identifier_token.value;
     
     // NOTE(Jose): If this isn't true means it's a type default initialization
-    if (PeekToken(parser, identifier_token.skip_size).kind != TokenKind_OpenParenthesis || TypeFromName(program, identifier) != nil_type)
+    if (PeekToken(parser, 1).kind != TokenKind_OpenParenthesis || TypeFromName(program, identifier) != nil_type)
     {
         Location type_location = FetchUntil(parser, false, TokenKind_OpenParenthesis);
         Assert(LocationIsValid(type_location));
@@ -2519,6 +2729,7 @@ String DebugInfoFromToken(Arena* arena, Token token)
     if (k == TokenKind_Comment) { return StrFormat(arena, "Comment: %S", token.value); }
     if (k == TokenKind_Comma) return ",";
     if (k == TokenKind_Dot) return ".";
+    if (k == TokenKind_Range) return "..";
     if (k == TokenKind_Colon) return ":";
     if (k == TokenKind_OpenBrace) return "{";
     if (k == TokenKind_CloseBrace) return "}";
@@ -2660,282 +2871,541 @@ internal_fn Token TokenMakeDynamic(String text, U64 cursor, TokenKind kind, U64
     }
     
     Token token{};
+    token.kind = kind;
     token.value = StrSub(text, cursor, size);
     token.skip_size = (U32)token.value.size;
     token.cursor = cursor;
     token.location = LocationMake(cursor, cursor + token.value.size, script_id);
     
-    if (kind == TokenKind_Identifier) {
-        if (StrEquals("null", token.value)) kind = TokenKind_NullKeyword;
-        else if (StrEquals("if", token.value)) kind = TokenKind_IfKeyword;
-        else if (StrEquals("then", token.value)) kind = TokenKind_ThenKeyword;
-        else if (StrEquals("case", token.value)) kind = TokenKind_CaseKeyword;
-        else if (StrEquals("else", token.value)) kind = TokenKind_ElseKeyword;
-        else if (StrEquals("while", token.value)) kind = TokenKind_WhileKeyword;
-        else if (StrEquals("for", token.value)) kind = TokenKind_ForKeyword;
-        else if (StrEquals("is", token.value)) kind = TokenKind_IsKeyword;
-        else if (StrEquals("func", token.value)) kind = TokenKind_FuncKeyword;
-        else if (StrEquals("enum", token.value)) kind = TokenKind_EnumKeyword;
-        else if (StrEquals("struct", token.value)) kind = TokenKind_StructKeyword;
-        else if (StrEquals("arg", token.value)) kind = TokenKind_ArgKeyword;
-        else if (StrEquals("return", token.value)) kind = TokenKind_ReturnKeyword;
-        else if (StrEquals("break", token.value)) kind = TokenKind_BreakKeyword;
-        else if (StrEquals("continue", token.value)) kind = TokenKind_ContinueKeyword;
-        else if (StrEquals("import", token.value)) kind = TokenKind_ImportKeyword;
-        else if (StrEquals("true", token.value)) kind = TokenKind_BoolLiteral;
-        else if (StrEquals("false", token.value)) kind = TokenKind_BoolLiteral;
-        else if (StrEquals("cast", token.value)) kind = TokenKind_CastKeyword;
-        else if (StrEquals("bitcast", token.value)) kind = TokenKind_BitCastKeyword;
-    }
-    
-    token.kind = kind;
-    
     // Discard double quotes
     if (token.kind == TokenKind_StringLiteral) {
         Assert(token.value.size >= 2);
         token.value = StrSub(token.value, 1, token.value.size - 2);
     }
     
+    if (token.kind == TokenKind_Assignment) {
+        token.assignment_operator = AssignmentOperatorFromChar(token.value[0]);
+    }
+    
     return token;
 }
 
-internal_fn Token TokenMakeFixed(String text, U64 cursor, TokenKind kind, U32 codepoint_length, I32 script_id)
+//- LEXER TABLES
+
+enum CharFlag : U8 {
+    CharFlag_Separator = 1 << 0,
+    CharFlag_Letter = 1 << 1,
+    CharFlag_Digit = 1 << 2,
+    CharFlag_IdentifierBody = 1 << 3,
+    CharFlag_Whitespace = 1 << 4, // Separators and new lines
+};
+
+struct CharFlagTable {
+    U8 flags[256];
+};
+
+constexpr CharFlagTable MakeCharFlagTable()
 {
-    U64 start_cursor = cursor;
+    CharFlagTable table{};
     
-    U32 index = 0;
-    while (index < codepoint_length && cursor < text.size) {
-        index++;
-        StrGetCodepoint(text, &cursor);
-    }
+    table.flags[' '] = CharFlag_Separator | CharFlag_Whitespace;
+    table.flags['\t'] = CharFlag_Separator | CharFlag_Whitespace;
+    table.flags['\r'] = CharFlag_Separator | CharFlag_Whitespace;
+    table.flags['\n'] = CharFlag_Whitespace;
+    table.flags['_'] = CharFlag_IdentifierBody;
+    
+    for (U32 c = 'a'; c <= 'z'; ++c) table.flags[c] = CharFlag_Letter | CharFlag_IdentifierBody;
+    for (U32 c = 'A'; c <= 'Z'; ++c) table.flags[c] = CharFlag_Letter | CharFlag_IdentifierBody;
+    for (U32 c = '0'; c <= '9'; ++c) table.flags[c] = CharFlag_Digit | CharFlag_IdentifierBody;
     
-    return TokenMakeDynamic(text, start_cursor, kind, cursor - start_cursor, script_id);
+    return table;
 }
 
-internal_fn Token TokenFromAssignment(String text, U64 cursor, OperatorKind op, U32 codepoint_length, I32 script_id)
+internal_fn constexpr CharFlagTable char_flag_table = MakeCharFlagTable();
+
+struct KeywordDefinition {
+    const char* text;
+    TokenKind kind;
+};
+
+constexpr KeywordDefinition keyword_definitions[] = {
+    { "null", TokenKind_NullKeyword },
+    { "if", TokenKind_IfKeyword },
+    { "then", TokenKind_ThenKeyword },
+    { "case", TokenKind_CaseKeyword },
+    { "else", TokenKind_ElseKeyword },
+    { "while", TokenKind_WhileKeyword },
+    { "for", TokenKind_ForKeyword },
+    { "is", TokenKind_IsKeyword },
+    { "func", TokenKind_FuncKeyword },
+    { "enum", TokenKind_EnumKeyword },
+    { "struct", TokenKind_StructKeyword },
+    { "arg", TokenKind_ArgKeyword },
+    { "return", TokenKind_ReturnKeyword },
+    { "break", TokenKind_BreakKeyword },
+    { "continue", TokenKind_ContinueKeyword },
+    { "import", TokenKind_ImportKeyword },
+    { "true", TokenKind_BoolLiteral },
+    { "false", TokenKind_BoolLiteral },
+    { "cast", TokenKind_CastKeyword },
+    { "bitcast", TokenKind_BitCastKeyword },
+};
+
+// NOTE(Jose): Perfect hash for the keyword set, the static_assert below fails if a new keyword collides
+constexpr U32 KeywordHash(U32 first, U32 last, U64 size) {
+    return (first * 5 + last * 23 + (U32)size * 7) & 31;
+}
+
+struct KeywordSlot {
+    const char* text;
+    U32 size;
+    TokenKind kind;
+};
+
+struct KeywordTable {
+    KeywordSlot slots[32];
+    U32 count;
+};
+
+constexpr KeywordTable MakeKeywordTable()
 {
-    Token token = TokenMakeFixed(text, cursor, TokenKind_Assignment, codepoint_length, script_id);
-    token.assignment_operator = op;
-    return token;
+    KeywordTable table{};
+    
+    for (const KeywordDefinition& keyword : keyword_definitions)
+    {
+        U32 size = 0;
+        while (keyword.text[size] != 0) size++;
+        
+        KeywordSlot& slot = table.slots[KeywordHash((U8)keyword.text[0], (U8)keyword.text[size - 1], size)];
+        if (slot.text == NULL) table.count++;
+        
+        slot.text = keyword.text;
+        slot.size = size;
+        slot.kind = keyword.kind;
+    }
+    
+    return table;
 }
 
-Token ReadToken(String text, U64 start_cursor, I32 script_id)
+internal_fn constexpr KeywordTable keyword_table = MakeKeywordTable();
+static_assert(keyword_table.count == countof(keyword_definitions), "Keyword hash collision");
+
+internal_fn TokenKind KeywordFromIdentifier(const U8* data, U64 size)
 {
-    PROFILE_FUNCTION;
+    if (size < 2 || size > 8) return TokenKind_Identifier;
     
-    U32 c0, c1;
+    const KeywordSlot& slot = keyword_table.slots[KeywordHash(data[0], data[size - 1], size)];
+    if (slot.size != size || memcmp(slot.text, data, size) != 0) return TokenKind_Identifier;
     
-    {
-        U64 cursor = start_cursor;
-        c0 = (cursor < text.size) ? StrGetCodepoint(text, &cursor) : 0;
-        c1 = (cursor < text.size) ? StrGetCodepoint(text, &cursor) : 0;
+    return slot.kind;
+}
+
+//- LEXER
+
+// Skips chars with the flag, new lines are only included when the flag is CharFlag_Whitespace
+internal_fn U64 SkipSpaces(const U8* data, U64 size, U64 cursor, CharFlag flag)
+{
+    // Most runs are a single space between tokens
+    if (cursor >= size || !(char_flag_table.flags[data[cursor]] & flag)) return cursor;
+
+#if SIMD_SSE2
+    __m128i space = _mm_set1_epi8(' ');
+    __m128i tab = _mm_set1_epi8('\t');
+    __m128i carriage_return = _mm_set1_epi8('\r');
+    __m128i new_line = _mm_set1_epi8((flag == CharFlag_Whitespace) ? '\n' : ' ');
+    
+    while (cursor + 16 <= size) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(data + cursor));
+        __m128i separators = _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab));
+        separators = _mm_or_si128(separators, _mm_or_si128(_mm_cmpeq_epi8(chunk, carriage_return), _mm_cmpeq_epi8(chunk, new_line)));
+        U32 mask = ~(U32)_mm_movemask_epi8(separators) & 0xFFFF;
+        if (mask != 0) return cursor + CountTrailingZeros32(mask);
+        cursor += 16;
     }
+#endif
     
-    if (c0 == 0) {
-        return TokenMakeFixed(text, start_cursor, TokenKind_NextLine, 1, script_id);
+    while (cursor < size && (char_flag_table.flags[data[cursor]] & flag)) cursor++;
+    return cursor;
+}
+
+internal_fn U64 SkipIdentifierBody(const U8* data, U64 size, U64 cursor)
+{
+#if SIMD_SSE2
+    // NOTE(Jose): Signed compares, bytes above 0x7F are negative and never match a range
+    __m128i case_bit = _mm_set1_epi8(0x20);
+    __m128i before_a = _mm_set1_epi8('a' - 1);
+    __m128i after_z = _mm_set1_epi8('z' + 1);
+    __m128i before_0 = _mm_set1_epi8('0' - 1);
+    __m128i after_9 = _mm_set1_epi8('9' + 1);
+    __m128i underscore = _mm_set1_epi8('_');
+    
+    while (cursor + 16 <= size) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(data + cursor));
+        __m128i lower = _mm_or_si128(chunk, case_bit);
+        __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(lower, before_a), _mm_cmplt_epi8(lower, after_z));
+        __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(chunk, before_0), _mm_cmplt_epi8(chunk, after_9));
+        __m128i body = _mm_or_si128(_mm_or_si128(letters, digits), _mm_cmpeq_epi8(chunk, underscore));
+        U32 mask = ~(U32)_mm_movemask_epi8(body) & 0xFFFF;
+        if (mask != 0) return cursor + CountTrailingZeros32(mask);
+        cursor += 16;
     }
+#endif
     
-    if (CodepointIsSeparator(c0))
-    {
-        U64 cursor = start_cursor;
-        while (cursor < text.size) {
-            U64 next_cursor = cursor;
-            U32 codepoint = StrGetCodepoint(text, &next_cursor);
-            if (!CodepointIsSeparator(codepoint)) {
-                break;
-            }
-            cursor = next_cursor;
-        }
-        return TokenMakeDynamic(text, start_cursor, TokenKind_Separator, cursor - start_cursor, script_id);
+    while (cursor < size && (char_flag_table.flags[data[cursor]] & CharFlag_IdentifierBody)) cursor++;
+    return cursor;
+}
+
+// Returns the position of the next '*' or '/'
+internal_fn U64 FindCommentDelimiter(const U8* data, U64 size, U64 cursor)
+{
+#if SIMD_SSE2
+    __m128i asterisk = _mm_set1_epi8('*');
+    __m128i slash = _mm_set1_epi8('/');
+    
+    while (cursor + 16 <= size) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(data + cursor));
+        U32 mask = (U32)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, asterisk), _mm_cmpeq_epi8(chunk, slash)));
+        if (mask != 0) return cursor + CountTrailingZeros32(mask);
+        cursor += 16;
     }
+#endif
     
-    if (c0 == '/' && c1 == '/')
+    while (cursor < size && data[cursor] != '*' && data[cursor] != '/') cursor++;
+    return cursor;
+}
+
+// Returns the cursor after the first closing char that isn't escaped
+internal_fn U64 FindClosingChar(String text, U64 begin, U8 close)
+{
+    U64 cursor = begin;
+    while (true)
     {
-        U64 cursor = start_cursor;
-        while (cursor < text.size) {
-            U64 next_cursor = cursor;
-            U32 codepoint = StrGetCodepoint(text, &next_cursor);
-            if (codepoint == '\n') break;
-            cursor = next_cursor;
-        }
-        return TokenMakeDynamic(text, start_cursor, TokenKind_Comment, cursor - start_cursor, script_id);
+        cursor = StrFindByte(text, cursor, close);
+        if (cursor >= text.size) return text.size;
+        
+        U64 backslash_count = 0;
+        while (cursor - backslash_count > begin && text.data[cursor - backslash_count - 1] == '\\') backslash_count++;
+        
+        if (backslash_count % 2 == 0) return cursor + 1;
+        cursor++;
     }
+}
+
+internal_fn U64 FindBlockCommentEnd(const U8* data, U64 size, U64 start_cursor)
+{
+    U64 cursor = start_cursor;
+    U32 last_char = 0;
+    I32 depth = 0;
     
-    if (c0 == '/' && c1 == '*')
+    while (cursor < size)
     {
-        U64 cursor = start_cursor;
-        U64 last_codepoint = 0;
-        I32 depth = 0;
-        while (cursor < text.size) 
-        {
-            U32 codepoint = StrGetCodepoint(text, &cursor);
-            if (last_codepoint == '*' && codepoint == '/') {
-                depth--;
-                if (depth == 0) {
-                    break;
-                }
-            }
-            if (last_codepoint == '/' && codepoint == '*') {
-                depth++;
-            }
-            last_codepoint = codepoint;
+        U32 c = data[cursor];
+        
+        // Only '*' and '/' change the state, everything in between is skipped in blocks
+        if (c != '*' && c != '/') {
+            cursor = FindCommentDelimiter(data, size, cursor + 1);
+            last_char = 0;
+            continue;
         }
-        return TokenMakeDynamic(text, start_cursor, TokenKind_Comment, cursor - start_cursor, script_id);
-    }
-    
-    if (c0 == '"') {
-        B32 ignore_next = false;
-        U64 cursor = start_cursor + 1;
-        while (cursor < text.size) {
-            U32 codepoint = StrGetCodepoint(text, &cursor);
-            
-            if (ignore_next) {
-                ignore_next = false;
-                continue;
-            }
-            
-            if (codepoint == '\\') ignore_next = true;
-            if (codepoint == '"') break;
+        
+        cursor++;
+        
+        if (last_char == '*' && c == '/') {
+            depth--;
+            if (depth == 0) break;
         }
-        return TokenMakeDynamic(text, start_cursor, TokenKind_StringLiteral, cursor - start_cursor, script_id);
-    }
-    
-    if (c0 == '\'') {
-        B32 ignore_next = false;
-        U64 cursor = start_cursor + 1;
-        while (cursor < text.size) {
-            U32 codepoint = StrGetCodepoint(text, &cursor);
-            
-            if (ignore_next) {
-                ignore_next = false;
-                continue;
-            }
-            
-            if (codepoint == '\\') ignore_next = true;
-            if (codepoint == '\'') break;
+        if (last_char == '/' && c == '*') {
+            depth++;
         }
-        return TokenMakeDynamic(text, start_cursor, TokenKind_CodepointLiteral, cursor - start_cursor, script_id);
+        last_char = c;
     }
     
-    if (c0 == '-' && c1 == '>') return TokenMakeFixed(text, start_cursor, TokenKind_Arrow, 2, script_id);
-    
-    if (c0 == ',') return TokenMakeFixed(text, start_cursor, TokenKind_Comma, 1, script_id);
-    if (c0 == '.') return TokenMakeFixed(text, start_cursor, TokenKind_Dot, 1, script_id);
-    if (c0 == '{') return TokenMakeFixed(text, start_cursor, TokenKind_OpenBrace, 1, script_id);
-    if (c0 == '}') return TokenMakeFixed(text, start_cursor, TokenKind_CloseBrace, 1, script_id);
-    if (c0 == '[') return TokenMakeFixed(text, start_cursor, TokenKind_OpenBracket, 1, script_id);
-    if (c0 == ']') return TokenMakeFixed(text, start_cursor, TokenKind_CloseBracket, 1, script_id);
-    if (c0 == '"') return TokenMakeFixed(text, start_cursor, TokenKind_OpenString, 1, script_id);
-    if (c0 == '(') return TokenMakeFixed(text, start_cursor, TokenKind_OpenParenthesis, 1, script_id);
-    if (c0 == ')') return TokenMakeFixed(text, start_cursor, TokenKind_CloseParenthesis, 1, script_id);
-    if (c0 == ':') return TokenMakeFixed(text, start_cursor, TokenKind_Colon, 1, script_id);
-    if (c0 == ';') return TokenMakeFixed(text, start_cursor, TokenKind_NextSentence, 1, script_id);
-    if (c0 == '\n') return TokenMakeFixed(text, start_cursor, TokenKind_NextLine, 1, script_id);
-    if (c0 == '_') return TokenMakeFixed(text, start_cursor, TokenKind_Identifier, 1, script_id);
-    
-    if (c0 == '+' && c1 == '=') return TokenFromAssignment(text, start_cursor, OperatorKind_Addition, 2, script_id);
-    if (c0 == '-' && c1 == '=') return TokenFromAssignment(text, start_cursor, OperatorKind_Substraction, 2, script_id);
-    if (c0 == '*' && c1 == '=') return TokenFromAssignment(text, start_cursor, OperatorKind_Multiplication, 2, script_id);
-    if (c0 == '/' && c1 == '=') return TokenFromAssignment(text, start_cursor, OperatorKind_Division, 2, script_id);
-    if (c0 == '%' && c1 == '=') return TokenFromAssignment(text, start_cursor, OperatorKind_Modulo, 2, script_id);
-    
-    if (c0 == '=' && c1 == '=') return TokenMakeFixed(text, start_cursor, TokenKind_CompEquals, 2, script_id);
-    if (c0 == '!' && c1 == '=') return TokenMakeFixed(text, start_cursor, TokenKind_CompNotEquals, 2, script_id);
-    if (c0 == '<' && c1 == '=') return TokenMakeFixed(text, start_cursor, TokenKind_CompLessEquals, 2, script_id);
-    if (c0 == '>' && c1 == '=') return TokenMakeFixed(text, start_cursor, TokenKind_CompGreaterEquals, 2, script_id);
+    return cursor;
+}
+
+// NOTE(Jose): Every token kind starts with an ASCII char and UTF-8 never encodes ASCII bytes inside multibyte codepoints,
+// so the lexer works with raw bytes. Multibyte codepoints only end up in error tokens or inside literals and comments.
+// Returns the cursor after the token
+internal_fn U64 LexToken(String text, U64 start_cursor, TokenKind* kind)
+{
+    const U8* data = (const U8*)text.data;
+    U64 size = text.size;
     
-    if (c0 == '|' && c1 == '|') return TokenMakeFixed(text, start_cursor, TokenKind_LogicalOr, 2, script_id);
-    if (c0 == '&' && c1 == '&') return TokenMakeFixed(text, start_cursor, TokenKind_LogicalAnd, 2, script_id);
+    U32 c0 = (start_cursor < size) ? data[start_cursor] : 0;
+    U32 c1 = (start_cursor + 1 < size) ? data[start_cursor + 1] : 0;
+    U8 flags = char_flag_table.flags[c0];
     
-    if (c0 == '=') return TokenFromAssignment(text, start_cursor, OperatorKind_None, 1, script_id);
+    if (flags & CharFlag_Separator) {
+        *kind = TokenKind_Separator;
+        return SkipSpaces(data, size, start_cursor + 1, CharFlag_Separator);
+    }
     
-    if (c0 == '<') return TokenMakeFixed(text, start_cursor, TokenKind_CompLess, 1, script_id);
-    if (c0 == '>') return TokenMakeFixed(text, start_cursor, TokenKind_CompGreater, 1, script_id);
+    if (flags & CharFlag_Letter) {
+        U64 cursor = SkipIdentifierBody(data, size, start_cursor + 1);
+        *kind = KeywordFromIdentifier(data + start_cursor, cursor - start_cursor);
+        return cursor;
+    }
     
-    if (CodepointIsNumber(c0))
+    if (flags & CharFlag_Digit)
     {
         U32 dot_count = 0;
         U64 cursor = start_cursor;
         
-        while (cursor < text.size) {
-            U64 next_cursor = cursor;
-            U32 codepoint = StrGetCodepoint(text, &next_cursor);
+        while (cursor < size) {
+            U32 c = data[cursor];
             
-            if (CodepointIsNumber(codepoint)) { }
-            else if (codepoint == '.') {
+            if (char_flag_table.flags[c] & CharFlag_Digit) { }
+            else if (c == '.') {
+                // Range operator after an int literal
+                if (cursor + 1 < size && data[cursor + 1] == '.') break;
                 dot_count++;
             }
             else {
                 break;
             }
             
-            cursor = next_cursor;
+            cursor++;
         }
         
-        TokenKind kind;
-        
-        if (dot_count == 0) {
-            kind = TokenKind_IntLiteral;
-        }
-        else if (dot_count == 1) {
-            kind = TokenKind_FloatLiteral;
-        }
-        else {
-            kind = TokenKind_Error;
-        }
+        if (dot_count == 0) *kind = TokenKind_IntLiteral;
+        else if (dot_count == 1) *kind = TokenKind_FloatLiteral;
+        else *kind = TokenKind_Error;
         
-        return TokenMakeDynamic(text, start_cursor, kind, cursor - start_cursor, script_id);
+        return cursor;
     }
     
-    if (CodepointIsText(c0))
+    switch (c0)
     {
-        U64 cursor = start_cursor;
-        while (cursor < text.size) {
-            U64 next_cursor = cursor;
-            U32 codepoint = StrGetCodepoint(text, &next_cursor);
-            if (!CodepointIsText(codepoint) && !CodepointIsNumber(codepoint) && codepoint != '_') {
-                break;
+        case 0:
+        case '\n': *kind = TokenKind_NextLine; return Min(start_cursor + 1, size);
+        
+        case '/':
+        {
+            if (c1 == '/') {
+                *kind = TokenKind_Comment;
+                return StrFindByte(text, start_cursor, '\n');
             }
-            cursor = next_cursor;
+            if (c1 == '*') {
+                *kind = TokenKind_Comment;
+                return FindBlockCommentEnd(data, size, start_cursor);
+            }
+            if (c1 == '=') { *kind = TokenKind_Assignment; return start_cursor + 2; }
+            *kind = TokenKind_Slash;
+            return start_cursor + 1;
+        }
+        
+        case '"': *kind = TokenKind_StringLiteral; return FindClosingChar(text, start_cursor + 1, '"');
+        case '\'': *kind = TokenKind_CodepointLiteral; return FindClosingChar(text, start_cursor + 1, '\'');
+        
+        case '-':
+        {
+            if (c1 == '>') { *kind = TokenKind_Arrow; return start_cursor + 2; }
+            if (c1 == '=') { *kind = TokenKind_Assignment; return start_cursor + 2; }
+            *kind = TokenKind_MinusSign;
+            return start_cursor + 1;
+        }
+        
+        case '.':
+        {
+            if (c1 == '.') { *kind = TokenKind_Range; return start_cursor + 2; }
+            *kind = TokenKind_Dot;
+            return start_cursor + 1;
+        }
+        
+        case ',': *kind = TokenKind_Comma; return start_cursor + 1;
+        case '{': *kind = TokenKind_OpenBrace; return start_cursor + 1;
+        case '}': *kind = TokenKind_CloseBrace; return start_cursor + 1;
+        case '[': *kind = TokenKind_OpenBracket; return start_cursor + 1;
+        case ']': *kind = TokenKind_CloseBracket; return start_cursor + 1;
+        case '(': *kind = TokenKind_OpenParenthesis; return start_cursor + 1;
+        case ')': *kind = TokenKind_CloseParenthesis; return start_cursor + 1;
+        case ':': *kind = TokenKind_Colon; return start_cursor + 1;
+        case ';': *kind = TokenKind_NextSentence; return start_cursor + 1;
+        case '_': *kind = TokenKind_Identifier; return start_cursor + 1;
+        
+        case '+':
+        {
+            if (c1 == '=') { *kind = TokenKind_Assignment; return start_cursor + 2; }
+            *kind = TokenKind_PlusSign;
+            return start_cursor + 1;
+        }
+        
+        case '*':
+        {
+            if (c1 == '=') { *kind = TokenKind_Assignment; return start_cursor + 2; }
+            *kind = TokenKind_Asterisk;
+            return start_cursor + 1;
+        }
+        
+        case '%':
+        {
+            if (c1 == '=') { *kind = TokenKind_Assignment; return start_cursor + 2; }
+            *kind = TokenKind_Modulo;
+            return start_cursor + 1;
+        }
+        
+        case '=':
+        {
+            if (c1 == '=') { *kind = TokenKind_CompEquals; return start_cursor + 2; }
+            *kind = TokenKind_Assignment;
+            return start_cursor + 1;
+        }
+        
+        case '!':
+        {
+            if (c1 == '=') { *kind = TokenKind_CompNotEquals; return start_cursor + 2; }
+            *kind = TokenKind_Exclamation;
+            return start_cursor + 1;
+        }
+        
+        case '<':
+        {
+            if (c1 == '=') { *kind = TokenKind_CompLessEquals; return start_cursor + 2; }
+            *kind = TokenKind_CompLess;
+            return start_cursor + 1;
+        }
+        
+        case '>':
+        {
+            if (c1 == '=') { *kind = TokenKind_CompGreaterEquals; return start_cursor + 2; }
+            *kind = TokenKind_CompGreater;
+            return start_cursor + 1;
+        }
+        
+        case '|':
+        {
+            if (c1 == '|') { *kind = TokenKind_LogicalOr; return start_cursor + 2; }
+            break;
+        }
+        
+        case '&':
+        {
+            if (c1 == '&') { *kind = TokenKind_LogicalAnd; return start_cursor + 2; }
+            *kind = TokenKind_Ampersand;
+            return start_cursor + 1;
         }
-        return TokenMakeDynamic(text, start_cursor, TokenKind_Identifier, cursor - start_cursor, script_id);
     }
     
-    if (c0 == '+') return TokenMakeFixed(text, start_cursor, TokenKind_PlusSign, 1, script_id);
-    if (c0 == '-') return TokenMakeFixed(text, start_cursor, TokenKind_MinusSign, 1, script_id);
-    if (c0 == '*') return TokenMakeFixed(text, start_cursor, TokenKind_Asterisk, 1, script_id);
-    if (c0 == '/') return TokenMakeFixed(text, start_cursor, TokenKind_Slash, 1, script_id);
-    if (c0 == '%') return TokenMakeFixed(text, start_cursor, TokenKind_Modulo, 1, script_id);
-    
-    if (c0 == '&') return TokenMakeFixed(text, start_cursor, TokenKind_Ampersand, 1, script_id);
-    if (c0 == '!') return TokenMakeFixed(text, start_cursor, TokenKind_Exclamation, 1, script_id);
+    // Unknown codepoint
+    U64 cursor = start_cursor;
+    StrGetCodepoint(text, &cursor);
+    *kind = TokenKind_Error;
+    return cursor;
+}
+
+Token ReadToken(String text, U64 start_cursor, I32 script_id)
+{
+    PROFILE_FUNCTION;
     
-    return TokenMakeFixed(text, start_cursor, TokenKind_Error, 1, script_id);
+    TokenKind kind;
+    U64 end_cursor = LexToken(text, start_cursor, &kind);
+    return TokenMakeDynamic(text, start_cursor, kind, end_cursor - start_cursor, script_id);
 }
 
-Token ReadValidToken(String text, U64 start_cursor, U64 end_cursor, I32 script_id)
+template<typename T>
+internal_fn T* TokenBufferGrow(T* data, U32 count, U32 capacity)
 {
-    Assert(end_cursor <= text.size);
+    T* new_data = ArenaPushStruct<T>(context.arena, capacity);
+    MemoryCopy(new_data, data, count * sizeof(T));
+    return new_data;
+}
+
+TokenArray TokenArrayFromText(Arena* arena, String text, RangeU64 range)
+{
+    PROFILE_FUNCTION;
     
-    U32 total_skip_size = 0;
-    Token token;
+    Assert(range.max <= text.size && text.size <= U32_MAX);
     
-    while (true) {
-        token = {};
-        I64 cursor = (I64)start_cursor + total_skip_size;
-        if (cursor < 0 || cursor >= end_cursor) break;
+    U32 capacity = (U32)Max((range.max - range.min) / 4, (U64)64);
+    U32 count = 0;
+    U8* kinds = ArenaPushStruct<U8>(context.arena, capacity);
+    U32* starts = ArenaPushStruct<U32>(context.arena, capacity);
+    U32* lengths = ArenaPushStruct<U32>(context.arena, capacity);
+    U32* matches = ArenaPushStruct<U32>(context.arena, capacity);
+    
+    // NOTE(Jose): Each scope kind is matched independently, the same way FindScope counted depth before caching tokens.
+    // Unmatched open tokens are linked through the matches array, scope_top is the last one of each kind
+    U32 scope_top[3] = { U32_MAX, U32_MAX, U32_MAX };
+    
+    const U8* data = (const U8*)text.data;
+    
+    U64 cursor = range.min;
+    while (cursor < range.max)
+    {
+        if (char_flag_table.flags[data[cursor]] & CharFlag_Whitespace) {
+            cursor = SkipSpaces(data, text.size, cursor + 1, CharFlag_Whitespace);
+            continue;
+        }
         
-        token = ReadToken(text, cursor, script_id);
+        TokenKind kind;
+        U64 end_cursor = LexToken(text, cursor, &kind);
         
-        total_skip_size += token.skip_size;
+        if (TokenIsValid(kind))
+        {
+            if (count == capacity) {
+                capacity *= 2;
+                kinds = TokenBufferGrow(kinds, count, capacity);
+                starts = TokenBufferGrow(starts, count, capacity);
+                lengths = TokenBufferGrow(lengths, count, capacity);
+                matches = TokenBufferGrow(matches, count, capacity);
+            }
+            
+            kinds[count] = (U8)kind;
+            starts[count] = (U32)cursor;
+            lengths[count] = (U32)(end_cursor - cursor);
+            matches[count] = U32_MAX;
+            
+            switch (kind)
+            {
+                // NOTE(Jose): Identifiers are interned while lexing, the later lookups by ID never take the intern lock
+                case TokenKind_Identifier: InternString(StrMake((const char*)data + cursor, end_cursor - cursor)); break;
+                
+                case TokenKind_OpenParenthesis: matches[count] = scope_top[0]; scope_top[0] = count; break;
+                case TokenKind_OpenBracket: matches[count] = scope_top[1]; scope_top[1] = count; break;
+                case TokenKind_OpenBrace: matches[count] = scope_top[2]; scope_top[2] = count; break;
+                
+                case TokenKind_CloseParenthesis:
+                case TokenKind_CloseBracket:
+                case TokenKind_CloseBrace:
+                {
+                    U32 scope = (kind == TokenKind_CloseParenthesis) ? 0 : (kind == TokenKind_CloseBracket) ? 1 : 2;
+                    U32 open_index = scope_top[scope];
+                    if (open_index != U32_MAX) {
+                        scope_top[scope] = matches[open_index];
+                        matches[open_index] = count;
+                    }
+                } break;
+            }
+            
+            count++;
+        }
         
-        if (TokenIsValid(token.kind)) break;
+        cursor = end_cursor;
     }
     
-    token.cursor = start_cursor;
-    token.skip_size = total_skip_size;
+    foreach(scope, countof(scope_top)) {
+        U32 index = scope_top[scope];
+        while (index != U32_MAX) {
+            U32 next = matches[index];
+            matches[index] = U32_MAX;
+            index = next;
+        }
+    }
     
-    return token;
+    TokenArray tokens{};
+    tokens.count = count;
+    tokens.range = range;
+    tokens.kinds = ArenaPushStruct<U8>(arena, count);
+    tokens.starts = ArenaPushStruct<U32>(arena, count);
+    tokens.lengths = ArenaPushStruct<U32>(arena, count);
+    tokens.matches = ArenaPushStruct<U32>(arena, count);
+    
+    MemoryCopy(tokens.kinds, kinds, count * sizeof(U8));
+    MemoryCopy(tokens.starts, starts, count * sizeof(U32));
+    MemoryCopy(tokens.lengths, lengths, count * sizeof(U32));
+    MemoryCopy(tokens.matches, matches, count * sizeof(U32));
+    
+    return tokens;
 }
 
 B32 TokenIsValid(TokenKind token)
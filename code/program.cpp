@@ -140,86 +140,190 @@ String StringFromDefinitionType(DefinitionType type)
     return "?";
 }
 
-Type* TypeFromArray(Program* program, Type* element, U32 dimension)
+inline_fn U32 SlotFromIdentifier(U32 id, U32 capacity)
 {
-    MutexLockGuard(&program->types_mutex);
+    return (id * 2654435761u) & (capacity - 1);
+}
+
+IdentifierTable IdentifierTableAlloc(Arena* arena, U32 count)
+{
+    U32 capacity = 16;
+    while (capacity < count * 2) capacity *= 2;
     
-    Type* type = element;
+    IdentifierTable table{};
+    table.slots = ArenaPushStruct<IdentifierSlot>(arena, capacity);
+    table.capacity = capacity;
+    return table;
+}
+
+void IdentifierTableInsert(IdentifierTable* table, U32 id, U32 index)
+{
+    Assert(id != 0);
+    
+    U32 slot_index = SlotFromIdentifier(id, table->capacity);
     
-    while (dimension > 0)
+    while (true)
     {
-        element = type;
+        IdentifierSlot* slot = &table->slots[slot_index];
+        U32 current_id = AtomicCompareExchange32_Full(&slot->id, 0, id);
         
-        foreach_BArray(it, &program->types)
-        {
-            Type* t = it.value;
-            
-            if (t->kind == VKind_Array && t->element_type == element) {
-                return t;
-            }
+        if (current_id == 0) {
+            slot->index = index;
+            AtomicIncrement32(&slot->count);
+            return;
         }
         
-        type = BArrayAdd(&program->types);
-        type->kind = VKind_Array;
-        type->name = StrFormat(program->arena, "Array[%S]", element->name);
-        type->element_type = element;
+        if (current_id == id) {
+            AtomicIncrement32(&slot->count);
+            return;
+        }
         
-        dimension--;
+        slot_index = (slot_index + 1) & (table->capacity - 1);
     }
-    
-    return type;
 }
 
-Type* TypeFromList(Program* program, Type* element, U32 dimension)
+IdentifierSlot* IdentifierTableFind(IdentifierTable* table, U32 id)
 {
-    MutexLockGuard(&program->types_mutex);
+    if (id == 0 || table->capacity == 0) return NULL;
     
-    Type* type = element;
+    U32 slot_index = SlotFromIdentifier(id, table->capacity);
     
-    while (dimension > 0)
+    while (true)
     {
-        element = type;
+        IdentifierSlot* slot = &table->slots[slot_index];
+        if (slot->id == id) return slot;
+        if (slot->id == 0) return NULL;
+        slot_index = (slot_index + 1) & (table->capacity - 1);
+    }
+}
+
+internal_fn void TypeNameTableInsert(TypeNameTable* table, Type* type)
+{
+    U32 slot_index = SlotFromIdentifier(type->name_id, table->capacity);
+    
+    while (true)
+    {
+        TypeNameSlot* slot = &table->slots[slot_index];
         
-        foreach_BArray(it, &program->types)
-        {
-            Type* t = it.value;
-            
-            if (t->kind == VKind_List && t->element_type == element) {
-                return t;
-            }
-        }
+        // NOTE(Jose): The first type with a name wins, same as the linear search did
+        if (slot->name_id == type->name_id) return;
         
-        type = BArrayAdd(&program->types);
-        type->kind = VKind_List;
-        type->name = StrFormat(program->arena, "List[%S]", element->name);
-        type->element_type = element;
+        if (slot->name_id == 0) {
+            slot->type = type;
+            AtomicStore32(&slot->name_id, type->name_id);
+            table->count++;
+            return;
+        }
         
-        dimension--;
+        slot_index = (slot_index + 1) & (table->capacity - 1);
     }
-    
-    return type;
 }
 
-Type* TypeFromReference(Program* program, Type* base_type)
+internal_fn void TypeNameTableAdd(Program* program, Type* type)
 {
-    MutexLockGuard(&program->types_mutex);
+    Assert(MutexIsLocked(&program->types_mutex));
     
-    foreach_BArray(it, &program->types)
+    TypeNameTable* table = program->type_names;
+    
+    if (table == NULL || (table->count + 1) * 2 > table->capacity)
     {
-        Type* t = it.value;
+        TypeNameTable* new_table = ArenaPushStruct<TypeNameTable>(program->arena);
+        new_table->capacity = (table == NULL) ? 256 : table->capacity * 2;
+        new_table->slots = ArenaPushStruct<TypeNameSlot>(program->arena, new_table->capacity);
         
-        if (t->kind == VKind_Reference && t->reference_base == base_type) {
-            return t;
+        if (table != NULL) {
+            foreach(i, table->capacity) {
+                if (table->slots[i].name_id != 0) TypeNameTableInsert(new_table, table->slots[i].type);
+            }
         }
+        
+        // NOTE(Jose): Published after it's filled, readers load the pointer once per lookup
+        CompilerWriteBarrier();
+        program->type_names = new_table;
+        table = new_table;
     }
     
-    Type* type = BArrayAdd(&program->types);
-    type->kind = VKind_Reference;
-    type->name = StrFormat(program->arena, "%S&", base_type->name);
-    type->reference_base = base_type;
+    TypeNameTableInsert(table, type);
+}
+
+// NOTE(Jose): Builtin types are global and read only, their derived types are cached in the program
+internal_fn TypeDerived* TypeDerivedFromType(Program* program, Type* type)
+{
+    U32 index;
+    
+    switch (type->kind) {
+        case VKind_Nil: index = 0; break;
+        case VKind_Void: index = 1; break;
+        case VKind_Any: index = 2; break;
+        case VKind_Primitive: index = 3 + type->primitive; break;
+        default: return &type->derived;
+    }
+    
+    Assert(index < countof(program->builtin_derived));
+    return &program->builtin_derived[index];
+}
+
+internal_fn Type* TypeDerive(Program* program, Type* base, VKind kind)
+{
+    TypeDerived* derived = TypeDerivedFromType(program, base);
+    
+    Type* volatile* slot = &derived->reference;
+    if (kind == VKind_Array) slot = &derived->array;
+    if (kind == VKind_List) slot = &derived->list;
+    
+    Type* type = *slot;
+    if (type != NULL) return type;
+    
+    MutexLockGuard(&program->types_mutex);
+    
+    // NOTE(Jose): Another lane could derive it before we take the lock
+    type = *slot;
+    if (type != NULL) return type;
+    
+    type = BArrayAdd(&program->types);
+    type->kind = kind;
+    
+    if (kind == VKind_Array) type->name = StrFormat(program->arena, "Array[%S]", base->name);
+    else if (kind == VKind_List) type->name = StrFormat(program->arena, "List[%S]", base->name);
+    else type->name = StrFormat(program->arena, "%S&", base->name);
+    
+    type->name_id = InternString(type->name);
+    
+    if (kind == VKind_Reference) type->reference_base = base;
+    else type->element_type = base;
+    
+    TypeNameTableAdd(program, type);
+    
+    // NOTE(Jose): Published once it's complete, lookups only load the pointer
+    CompilerWriteBarrier();
+    *slot = type;
+    
     return type;
 }
 
+Type* TypeFromArray(Program* program, Type* element, U32 dimension)
+{
+    Type* type = element;
+    foreach(i, dimension) {
+        type = TypeDerive(program, type, VKind_Array);
+    }
+    return type;
+}
+
+Type* TypeFromList(Program* program, Type* element, U32 dimension)
+{
+    Type* type = element;
+    foreach(i, dimension) {
+        type = TypeDerive(program, type, VKind_List);
+    }
+    return type;
+}
+
+Type* TypeFromReference(Program* program, Type* base_type)
+{
+    return TypeDerive(program, base_type, VKind_Reference);
+}
+
 Type* TypeFromPrimitive(PrimitiveType primitive)
 {
     switch (primitive) {
@@ -249,7 +353,9 @@ Type* TypeFromStruct(Program* program, StructDefinition* def)
     Type* type = BArrayAdd(&program->types);
     type->kind = VKind_Struct;
     type->name = def->identifier;
+    type->name_id = def->identifier_id;
     type->_struct = def;
+    TypeNameTableAdd(program, type);
     return type;
 }
 
@@ -269,7 +375,9 @@ Type* TypeFromEnum(Program* program, EnumDefinition* def)
     Type* type = BArrayAdd(&program->types);
     type->kind = VKind_Enum;
     type->name = def->identifier;
+    type->name_id = def->identifier_id;
     type->_enum = def;
+    TypeNameTableAdd(program, type);
     return type;
 }
 
@@ -407,15 +515,21 @@ Type* TypeFromName(Program* program, String name)
     if (name == "Float") return float_type;
     if (name == "String") return string_type;
     
-    MutexLockGuard(&program->types_mutex);
+    U32 name_id = InternFind(name);
+    if (name_id == 0) return nil_type;
     
-    foreach_BArray(it, &program->types) {
-        Type* t = it.value;
-        if (t->name == name) {
-            return t;
-        }
+    TypeNameTable* table = program->type_names;
+    if (table == NULL) return nil_type;
+    
+    U32 slot_index = SlotFromIdentifier(name_id, table->capacity);
+    
+    while (true)
+    {
+        TypeNameSlot* slot = &table->slots[slot_index];
+        if (slot->name_id == name_id) return slot->type;
+        if (slot->name_id == 0) return nil_type;
+        slot_index = (slot_index + 1) & (table->capacity - 1);
     }
-    return nil_type;
 }
 
 Type* TypeGetChildAt(Program* program, Type* type, U32 index, B32 is_member)
@@ -450,10 +564,11 @@ VariableTypeChild TypeGetChild(Program* program, Type* type, String name)
 VariableTypeChild TypeGetMember(Type* type, String member)
 {
     if (type->kind == VKind_Struct) {
-        Array<String> names = type->_struct->names;
-        foreach(i, names.count) {
-            if (names[i] == member) {
-                return { true, names[i], (I32)i, type->_struct->types[i] };
+        U32 member_id = InternFind(member);
+        Array<U32> name_ids = type->_struct->name_ids;
+        foreach(i, name_ids.count) {
+            if (name_ids[i] == member_id) {
+                return { true, type->_struct->names[i], (I32)i, type->_struct->types[i] };
             }
         }
     }
@@ -527,9 +642,12 @@ void DefinitionIdentify(Program* program, U32 index, DefinitionType type, String
     
     def->type = type;
     def->identifier = StrCopy(program->arena, identifier);
+    def->identifier_id = InternString(identifier);
     def->location = location;
     def->stage = DefinitionStage_Identified;
     
+    IdentifierTableInsert(&program->definition_table, def->identifier_id, index);
+    
     if (type == DefinitionType_Enum)
     {
         TypeFromEnum(program, &full_def->_enum);
@@ -587,6 +705,7 @@ void StructDefine(Program* program, StructDefinition* def, Array<ObjectDefinitio
     }
     
     Array<String> names = ArrayAlloc<String>(program->arena, members.count);
+    Array<U32> name_ids = ArrayAlloc<U32>(program->arena, members.count);
     Array<Type*> types = ArrayAlloc<Type*>(program->arena, members.count);
     
     foreach(i, members.count)
@@ -594,6 +713,7 @@ void StructDefine(Program* program, StructDefinition* def, Array<ObjectDefinitio
         ObjectDefinition member = members[i];
         
         names[i] = StrCopy(program->arena, member.name);
+        name_ids[i] = InternString(member.name);
         types[i] = member.type;
         
         if (!TypeIsValid(member.type)) {
@@ -605,6 +725,7 @@ void StructDefine(Program* program, StructDefinition* def, Array<ObjectDefinitio
     Assert(names.count == types.count);
     
     def->names = names;
+    def->name_ids = name_ids;
     def->types = types;
     def->stage = DefinitionStage_Defined;
     
@@ -650,6 +771,23 @@ void StructResolve(Program* program, StructDefinition* def)
     LogType("Struct Resolve: %S -> %u bytes", def->identifier, def->size);
 }
 
+void StructResolveLayout(Program* program, StructDefinition* def, Array<U32> offsets, U32 size, B32 needs_internal_release)
+{
+    if (def->stage != DefinitionStage_Defined) {
+        InvalidCodepath();
+        return;
+    }
+    
+    Assert(offsets.count == def->types.count);
+    
+    def->needs_internal_release = needs_internal_release;
+    def->offsets = ArrayCopy(program->arena, offsets);
+    def->size = size;
+    def->stage = DefinitionStage_Ready;
+    
+    LogType("Struct Resolve: %S -> %u bytes", def->identifier, def->size);
+}
+
 void FunctionDefine(Program* program, FunctionDefinition* def, Array<ObjectDefinition> parameters, Array<ObjectDefinition> returns)
 {
     if (def->stage != DefinitionStage_Identified) {
@@ -661,6 +799,7 @@ void FunctionDefine(Program* program, FunctionDefinition* def, Array<ObjectDefin
     def->returns = ObjectDefinitionArrayCopy(program->arena, returns);
     def->stage = DefinitionStage_Defined;
     
+#if LOG_TYPE_ENABLED
     StringBuilder builder = string_builder_make(context.arena);
     appendf(&builder, "Function Define: %S (", def->identifier);
     
@@ -681,6 +820,7 @@ void FunctionDefine(Program* program, FunctionDefinition* def, Array<ObjectDefin
     append(&builder, ")");
     
     LogType(string_from_builder(context.arena, &builder));
+#endif
 }
 
 void FunctionResolveIntrinsic(Program* program, FunctionDefinition* def, IntrinsicFunction* fn)
@@ -705,6 +845,7 @@ void FunctionResolve(Program* program, FunctionDefinition* def, IR ir)
     }
     
     def->defined.ir = ir;
+    CompilerWriteBarrier();
     def->stage = DefinitionStage_Ready;
     
     LogType("Function Resolve: %S", def->identifier);
@@ -731,6 +872,7 @@ void ArgResolve(Program* program, ArgDefinition* def, String name, String descri
     }
     
     def->name = StrCopy(program->arena, name);
+    def->name_id = InternString(name);
     def->description = StrCopy(program->arena, description);
     def->required = required;
     def->default_value = default_value;
@@ -741,13 +883,9 @@ void ArgResolve(Program* program, ArgDefinition* def, String name, String descri
 
 Definition* DefinitionFromIdentifier(Program* program, String identifier)
 {
-    foreach(i, program->definitions.count) {
-        Definition* def = &program->definitions[i];
-        if (StrEquals(def->header.identifier, identifier)) {
-            return def;
-        }
-    }
-    return NULL;
+    IdentifierSlot* slot = IdentifierTableFind(&program->definition_table, InternFind(identifier));
+    if (slot == NULL) return NULL;
+    return &program->definitions[slot->index];
 }
 
 Definition* DefinitionFromIndex(Program* program, U32 index)
@@ -756,6 +894,13 @@ Definition* DefinitionFromIndex(Program* program, U32 index)
     return &program->definitions[index];
 }
 
+U32 IndexFromDefinition(Program* program, DefinitionHeader* def)
+{
+    U32 index = (U32)((Definition*)def - program->definitions.data);
+    Assert(index < program->definitions.count);
+    return index;
+}
+
 B32 DefinitionExists(Program* program, String identifier)
 {
     return DefinitionFromIdentifier(program, identifier) != NULL;
@@ -812,10 +957,13 @@ ArgDefinition* ArgFromIndex(Program* program, U32 index)
 
 ArgDefinition* ArgFromName(Program* program, String name)
 {
+    U32 name_id = InternFind(name);
+    if (name_id == 0) return NULL;
+    
     foreach(i, program->definitions.count) {
         ArgDefinition* def = &program->definitions[i].arg;
         if (def->type != DefinitionType_Arg) continue;
-        if (StrEquals(def->name, name)) return def;
+        if (def->name_id == name_id) return def;
     }
     return NULL;
 }
@@ -831,11 +979,9 @@ void GlobalDefine(Program* program, U32 index, Type* type, B32 is_constant)
 
 I32 GlobalIndexFromIdentifier(Program* program, String identifier)
 {
-    foreach(i, program->globals.count) {
-        Global* global = &program->globals[i];
-        if (global->identifier == identifier) return i;
-    }
-    return -1;
+    IdentifierSlot* slot = IdentifierTableFind(&program->global_table, InternFind(identifier));
+    if (slot == NULL) return -1;
+    return slot->index;
 }
 
 Global* GlobalFromIdentifier(Program* program, String identifier)
@@ -1188,7 +1334,7 @@ String StrFromValue(Arena* arena, Program* program, Value value, B32 raw)
         if (value.type == int_type) return StrFromI64(arena, value.literal_sint);
         if (value.type == uint_type) return StrFromU64(arena, value.literal_uint);
         if (value.type == bool_type) return value.literal_bool ? "true" : "false";
-        if (value.type == float_type) return StrFromF64(arena, value.literal_float, 4);
+        if (value.type == float_type) return StrFromF64(arena, value.literal_float);
         if (value.type == string_type) {
             if (raw) return value.literal_string;
             String escape = escape_string_from_raw_string(context.arena, value.literal_string);
@@ -1450,6 +1596,8 @@ internal_fn String StringFromUnitInfo(Arena* arena, Program* program, Unit unit)
         case UnitKind_Store:
         return StrFormat(arena, "%S = %S", dst, src0);
         
+        case UnitKind_Append: return StrFormat(arena, "%S += %S", dst, src0);
+        
         case UnitKind_FunctionCall:
         {
             FunctionDefinition* fn = unit.function_call.fn;
@@ -1571,6 +1719,7 @@ String StringFromUnitKind(Arena* arena, UnitKind unit)
         case UnitKind_Error: return "error";
         case UnitKind_Copy: return "copy";
         case UnitKind_Store: return "store";
+        case UnitKind_Append: return "append";
         case UnitKind_FunctionCall: return "call";
         case UnitKind_Return: return "return";
         case UnitKind_Jump: return "jump";
@@ -55,9 +55,17 @@ enum VKind {
 struct StructDefinition;
 struct EnumDefinition;
 struct FunctionDefinition;
+struct Type;
+
+struct TypeDerived {
+    Type* volatile array;
+    Type* volatile list;
+    Type* volatile reference;
+};
 
 struct Type {
     String name;
+    U32 name_id;
     VKind kind;
     
     union {
@@ -67,6 +75,8 @@ struct Type {
         Type* reference_base;
         Type* element_type;
     };
+    
+    TypeDerived derived;
 };
 
 struct Object {
@@ -77,10 +87,22 @@ struct Object {
     Object* next;
 };
 
+// Reference counted storage for string characters and array elements, shared between an owner, its copies and its views
+struct ObjectBlock {
+    I32 ref_count;
+    U32 orphan_count; // Elements left by an owner that released the block while views were still alive
+    Type* orphan_type;
+};
+
+// NOTE(Jose): Arrays and heap strings with zero capacity are views into storage owned by someone else.
+// Resizing, reordering or writing an element of a view copies it first. The owner writes in place, so its stores show in its views.
+// Copying a heap string also produces a view, strings are never written while their block is shared.
+
 struct ObjectData_Array {
     U32 count;
     U32 capacity;
     U8* data;
+    ObjectBlock* block;
 };
 
 struct ObjectData_Ref {
@@ -88,12 +110,25 @@ struct ObjectData_Ref {
     void* address;
 };
 
+#define STRING_INLINE_CAPACITY 24
+
+// Strings up to STRING_INLINE_CAPACITY bytes are stored inline, the size decides which member of the union is active
 struct ObjectData_String {
-    char* chars;
-    U64 capacity;
+    union {
+        struct {
+            char* chars;
+            U64 capacity;
+            ObjectBlock* block;
+        };
+        char inline_chars[STRING_INLINE_CAPACITY];
+    };
     U64 size;
 };
 
+inline_fn B32 StringDataIsInline(ObjectData_String* data) { return data->size <= STRING_INLINE_CAPACITY; }
+inline_fn B32 StringDataIsView(ObjectData_String* data) { return !StringDataIsInline(data) && data->capacity == 0; }
+inline_fn char* StringDataChars(ObjectData_String* data) { return StringDataIsInline(data) ? data->inline_chars : data->chars; }
+
 #define Type_Type TypeFromName(program, "Type")
 #define Type_Result TypeFromName(program, "Result")
 #define Type_CopyMode TypeFromName(program, "CopyMode")
@@ -102,6 +137,7 @@ struct ObjectData_String {
 #define Type_CallsContext TypeFromName(program, "CallsContext")
 #define Type_OS TypeFromName(program, "OS")
 #define Type_CallOutput TypeFromName(program, "CallOutput")
+#define Type_StringBuilder TypeFromName(program, "StringBuilder")
 #define Type_FileInfo TypeFromName(program, "FileInfo")
 #define Type_YovParseOutput TypeFromName(program, "YovParseOutput")
 #define Type_ObjectDefinition TypeFromName(program, "ObjectDefinition")
@@ -170,6 +206,7 @@ enum UnitKind {
     
     UnitKind_Copy,
     UnitKind_Store,
+    UnitKind_Append,
     UnitKind_FunctionCall,
     UnitKind_Return,
     UnitKind_Jump,
@@ -214,6 +251,7 @@ struct Unit {
         
         struct {
             B32 child_is_member;
+            B32 child_is_write; // Shared array storage is copied before the child is returned
         } child;
         
     };
@@ -247,6 +285,7 @@ struct IR {
 
 struct Global {
     String identifier;
+    U32 identifier_id;
     Type* type;
     B32 is_constant;
 };
@@ -291,11 +330,13 @@ struct DefinitionHeader {
     DefinitionType type;
     
     String identifier;
+    U32 identifier_id;
     Location location;
     volatile DefinitionStage stage;
 };
 
 struct Runtime;
+struct FrontContext;
 typedef void IntrinsicFunction(Runtime* runtime, Array<Reference> params, Array<Reference> returns);
 
 struct FunctionDefinition : DefinitionHeader {
@@ -315,6 +356,7 @@ struct FunctionDefinition : DefinitionHeader {
 
 struct ArgDefinition : DefinitionHeader {
     String name;
+    U32 name_id;
     String description;
     Type* value_type;
     B32 required;
@@ -323,6 +365,7 @@ struct ArgDefinition : DefinitionHeader {
 
 struct StructDefinition : DefinitionHeader {
     Array<String> names;
+    Array<U32> name_ids;
     Array<Type*> types;
     Array<U32> offsets;
     B32 needs_internal_release;
@@ -345,6 +388,38 @@ struct Definition {
     };
 };
 
+// NOTE(Jose): Open addressing table from interned identifiers to indices. Insertions are lock free,
+// lookups are valid once all the insertions are done. Inserting an identifier twice only increments its count
+
+struct IdentifierSlot {
+    volatile U32 id;
+    U32 index;
+    volatile U32 count;
+};
+
+struct IdentifierTable {
+    IdentifierSlot* slots;
+    U32 capacity;
+};
+
+IdentifierTable IdentifierTableAlloc(Arena* arena, U32 count);
+void IdentifierTableInsert(IdentifierTable* table, U32 id, U32 index);
+IdentifierSlot* IdentifierTableFind(IdentifierTable* table, U32 id);
+
+// NOTE(Jose): Types are inserted while holding types_mutex and looked up by name without the lock.
+// The table is replaced when it grows, a reader using the previous one still finds the types inserted before
+
+struct TypeNameSlot {
+    volatile U32 name_id;
+    Type* type;
+};
+
+struct TypeNameTable {
+    TypeNameSlot* slots;
+    U32 capacity;
+    U32 count;
+};
+
 struct Program
 {
     Arena* arena;
@@ -354,16 +429,23 @@ struct Program
     
     Mutex types_mutex;
     BArray<Type> types;
+    U32 front_type_count; // Types listed in context.types, snapshot taken before any body is compiled in the background
+    TypeNameTable* volatile type_names;
+    TypeDerived builtin_derived[8];
     
     Array<Definition> definitions;
+    IdentifierTable definition_table;
     U32 function_count;
     U32 struct_count;
     U32 enum_count;
     U32 arg_count;
     
     Array<Global> globals;
+    IdentifierTable global_table;
     IR globals_initialize_ir;
     IR args_initialize_ir;
+    
+    FrontContext* background; // Function bodies still compiling while the program runs
 };
 
 B32 TypeIsValid(Type* type);
@@ -443,6 +525,7 @@ void EnumResolve(Program* program, EnumDefinition* def, Array<I64> values);
 
 void StructDefine(Program* program, StructDefinition* def, Array<ObjectDefinition> members);
 void StructResolve(Program* program, StructDefinition* def);
+void StructResolveLayout(Program* program, StructDefinition* def, Array<U32> offsets, U32 size, B32 needs_internal_release);
 
 void FunctionDefine(Program* program, FunctionDefinition* def, Array<ObjectDefinition> parameters, Array<ObjectDefinition> returns);
 void FunctionResolveIntrinsic(Program* program, FunctionDefinition* def, IntrinsicFunction* fn);
@@ -453,6 +536,7 @@ void ArgResolve(Program* program, ArgDefinition* def, String name, String descri
 
 Definition* DefinitionFromIdentifier(Program* program, String identifier);
 Definition* DefinitionFromIndex(Program* program, U32 index);
+U32 IndexFromDefinition(Program* program, DefinitionHeader* def);
 B32 DefinitionExists(Program* program, String identifier);
 StructDefinition* StructFromIdentifier(Program* program, String identifier);
 StructDefinition* StructFromIndex(Program* program, U32 index);
@@ -489,6 +573,8 @@ void PrintIr(Program* program, String name, IR ir);
 IntrinsicFunction* IntrinsicFromIdentifier(String identifier);
 
 Program* ProgramFromInput(Arena* arena, Input* input, Reporter* reporter);
+B32 ProgramWaitFunction(Program* program, FunctionDefinition* fn);
+void ProgramFinishCompilation(Program* program);
 
 struct RuntimeSettings {
     B8 user_assert;
@@ -118,9 +118,12 @@ void RuntimeInitializeGlobals(Runtime* runtime)
         
         // Types
         {
-            Reference array = AllocArray(runtime, Type_Type, program->types.count);
+            // NOTE(Jose): Bodies compiled in the background keep adding types, the list only has the ones known by the front end
+            U32 type_count = program->front_type_count;
             
-            foreach(i, program->types.count) {
+            Reference array = AllocArray(runtime, Type_Type, type_count);
+            
+            foreach(i, type_count) {
                 Reference element = object_alloc(runtime, Type_Type);
                 ref_assign_Type(runtime, element, &program->types[i]);
                 ref_set_member(runtime, array, i, element);
@@ -594,17 +597,9 @@ Reference RefFromValue(Runtime* runtime, Scope* scope, Value value)
         PROFILE_SCOPE("StringComposition");
         if (value.type == string_type)
         {
-            Array<Value> sources = value.string_composition;
-            
-            StringBuilder builder = string_builder_make(context.arena);
-            foreach(i, sources.count)
-            {
-                Reference source = RefFromValue(runtime, scope, sources[i]);
-                if (is_unknown(source)) return ref_from_object(nil_obj);
-                append(&builder, StrFromRef(context.arena, runtime, source));
-            }
-            
-            return AllocString(runtime, string_from_builder(context.arena, &builder));
+            Reference ref = object_alloc(runtime, string_type);
+            if (!ref_string_set_composition(runtime, scope, ref, value.string_composition)) return ref_from_object(nil_obj);
+            return ref;
         }
     }
     
@@ -650,6 +645,13 @@ void RunInstruction(Runtime* runtime, Unit unit)
     Reporter* reporter = runtime->reporter;
     
     Scope* scope = RuntimeGetCurrentScope(runtime);
+    
+    if (unit.kind == UnitKind_Copy && unit.src0.kind == ValueKind_StringComposition) {
+        LogTrace("RUN: %S", StringFromUnit(context.arena, program, 0, 0, 0, unit));
+        RunCopyStringComposition(runtime, unit.dst_index, unit.src0);
+        return;
+    }
+    
     Reference src0 = RefFromValue(runtime, scope, unit.src0);
     Reference src1 = RefFromValue(runtime, scope, unit.src1);
     
@@ -671,6 +673,12 @@ void RunInstruction(Runtime* runtime, Unit unit)
             return;
         }
         
+        case UnitKind_Append:
+        {
+            RunAppend(runtime, dst_index, src0);
+            return;
+        }
+        
         case UnitKind_FunctionCall:
         {
             FunctionDefinition* fn = unit.function_call.fn;
@@ -696,7 +704,8 @@ void RunInstruction(Runtime* runtime, Unit unit)
         case UnitKind_Child:
         {
             B32 is_member = unit.child.child_is_member;
-            RunChild(runtime, dst_index, src0, src1, is_member);
+            B32 is_write = unit.child.child_is_write;
+            RunChild(runtime, dst_index, src0, src1, is_member, is_write);
             return;
         }
         
@@ -845,6 +854,60 @@ void RunCopy(Runtime* runtime, I32 dst_index, Reference src)
     RefCopy(runtime, dst, src);
 }
 
+// Self-appends ("a += b" and "a = a + b") grow the destination string in place
+void RunAppend(Runtime* runtime, I32 dst_index, Reference src)
+{
+    PROFILE_FUNCTION;
+    
+    Program* program = runtime->program;
+    Reporter* reporter = runtime->reporter;
+    
+    Reference dst = RuntimeLoad(runtime, RuntimeGetCurrentScope(runtime), dst_index);
+    
+    if (is_unknown(dst) || is_unknown(src)) {
+        InvalidCodepath();
+        return;
+    }
+    
+    if (is_null(dst) || is_null(src)) {
+        ReportNullRef();
+        return;
+    }
+    
+    if (TypeIsReference(dst.type)) {
+        dst = RefDereference(runtime, dst);
+        
+        if (is_null(dst)) {
+            ReportNullRef();
+            return;
+        }
+    }
+    
+    Assert(dst.type == string_type && src.type == string_type);
+    ref_string_append(runtime, dst, get_string(src));
+}
+
+// Interpolations are written straight into the destination string, reusing its capacity
+void RunCopyStringComposition(Runtime* runtime, I32 dst_index, Value src)
+{
+    PROFILE_FUNCTION;
+    
+    Program* program = runtime->program;
+    Scope* scope = RuntimeGetCurrentScope(runtime);
+    
+    Reference dst = RuntimeLoad(runtime, scope, dst_index);
+    
+    if (TypeIsReference(dst.type) && TypeGetNext(program, dst.type) == string_type) {
+        dst = RefDereference(runtime, dst);
+    }
+    
+    if (is_unknown(dst) || is_null(dst) || dst.type != string_type) {
+        RunCopy(runtime, dst_index, RefFromValue(runtime, scope, src));
+        return;
+    }
+    
+    ref_string_set_composition(runtime, scope, dst, src.string_composition);
+}
 
 void RunFunctionCall(Runtime* runtime, I32 dst_index, FunctionDefinition* fn, Array<Value> parameters)
 {
@@ -853,6 +916,9 @@ void RunFunctionCall(Runtime* runtime, I32 dst_index, FunctionDefinition* fn, Ar
     Program* program = runtime->program;
     Reporter* reporter = runtime->reporter;
     
+    // NOTE(Jose): The body can still be compiling in the background
+    if (!ProgramWaitFunction(program, fn)) return;
+    
     if (fn->is_intrinsic)
     {
         Array<Reference> returns = ArrayAlloc<Reference>(context.arena, fn->returns.count);
@@ -881,7 +947,7 @@ void RunFunctionCall(Runtime* runtime, I32 dst_index, FunctionDefinition* fn, Ar
     }
 }
 
-internal_fn Reference _RunChild(Runtime* runtime, Reference src, Reference index, B32 is_member)
+internal_fn Reference _RunChild(Runtime* runtime, Reference src, Reference index, B32 is_member, B32 is_write)
 {
     if (is_null(src)) {
         ReportNullRef();
@@ -901,13 +967,20 @@ internal_fn Reference _RunChild(Runtime* runtime, Reference src, Reference index
         return ref_from_object(null_obj);
     }
     
+    // NOTE(Jose): A view gets its own elements before one of them is modified. The owner never moves its storage here,
+    // references into its elements stay valid and its stores show in the views that weren't written
+    if (is_write && is_member && src.type->kind == VKind_Array) {
+        ObjectData_Array* array = RefGetArray(src);
+        if (array->capacity == 0 && array->block != NULL) RefArrayMakeUnique(runtime, src);
+    }
+    
     return ref_get_child(runtime, src, (U32)child_index, is_member);
 }
 
-void RunChild(Runtime* runtime, I32 dst_index, Reference src, Reference index, B32 is_member)
+void RunChild(Runtime* runtime, I32 dst_index, Reference src, Reference index, B32 is_member, B32 is_write)
 {
     PROFILE_FUNCTION;
-    Reference child = _RunChild(runtime, src, index, is_member);
+    Reference child = _RunChild(runtime, src, index, is_member, is_write);
     RuntimeStore(runtime, NULL, dst_index, child);
 }
 
@@ -1866,7 +1939,7 @@ String StrFromRef(Arena* arena, Runtime* runtime, Reference ref, B32 raw)
     }
     if (type == int_type) { return StrFromI64(arena, RefGetSInt(ref)); }
     if (type == uint_type) { return StrFromU64(arena, RefGetUInt(ref)); }
-    if (type == float_type) { return StrFromF64(arena, RefGetFloat(ref), 4); }
+    if (type == float_type) { return StrFromF64(arena, RefGetFloat(ref)); }
     if (type == bool_type) { return RefGetBool(ref) ? "true" : "false"; }
     if (type == void_type) { return "void"; }
     if (type == nil_type) { return "nil"; }
@@ -2284,7 +2357,7 @@ String get_string(Reference ref)
     
     ObjectData_String* data = (ObjectData_String*)ref.address;
     Assert(TypeGetSize(ref.type) == sizeof(ObjectData_String));
-    return StrMake(data->chars, data->size);
+    return StrMake(StringDataChars(data), data->size);
 }
 
 ObjectData_Array* RefGetArray(Reference ref)
@@ -2412,6 +2485,55 @@ void set_enum_index(Reference ref, I64 v)
     *data = v;
 }
 
+internal_fn void ArrayReleaseElements(Runtime* runtime, U8* data, U32 count, Type* element_type, B32 release_refs)
+{
+    Program* program = runtime->program;
+    if (!VTypeNeedsInternalRelease(program, element_type)) return;
+    
+    U32 element_size = TypeGetSize(element_type);
+    
+    U8* it = data;
+    U8* end = data + element_size * count;
+    
+    while (it < end)
+    {
+        Reference member = ref_from_address(NULL, element_type, it);
+        ref_release_internal(runtime, member, release_refs);
+        it += element_size;
+    }
+}
+
+ObjectBlock* ObjectBlockAlloc(Runtime* runtime, U64 size)
+{
+    ObjectBlock* block = (ObjectBlock*)object_dynamic_allocate(runtime, sizeof(ObjectBlock) + size);
+    block->ref_count = 1;
+    return block;
+}
+
+void* ObjectBlockData(ObjectBlock* block) {
+    return (block == NULL) ? NULL : (void*)(block + 1);
+}
+
+void ObjectBlockRetain(ObjectBlock* block) {
+    if (block == NULL) return;
+    block->ref_count++;
+}
+
+void ObjectBlockRelease(Runtime* runtime, ObjectBlock* block, B32 release_refs)
+{
+    if (block == NULL) return;
+    
+    block->ref_count--;
+    Assert(block->ref_count >= 0);
+    if (block->ref_count > 0) return;
+    
+    if (block->orphan_count > 0) {
+        ArrayReleaseElements(runtime, (U8*)ObjectBlockData(block), block->orphan_count, block->orphan_type, release_refs);
+    }
+    
+    object_dynamic_free(runtime, block);
+}
+
 ObjectData_String* ref_string_get_data(Runtime* runtime, Reference ref)
 {
     if (!is_string(ref)) {
@@ -2425,36 +2547,61 @@ ObjectData_String* ref_string_get_data(Runtime* runtime, Reference ref)
     return data;
 }
 
-void ref_string_prepare(Runtime* runtime, Reference ref, U64 new_size, B32 can_discard)
+// Makes the string writable and sets the new size, keeping the content unless can_discard.
+// Returns the previous block, which must be released by the caller once the old chars are not needed.
+internal_fn ObjectBlock* StringReserve(Runtime* runtime, ObjectData_String* data, U64 new_size, B32 can_discard)
 {
-    ObjectData_String* data = ref_string_get_data(runtime, ref);
-    if (data == NULL) return;
+    B32 was_inline = StringDataIsInline(data);
     
-    if (data->capacity > 0 && new_size <= 0)
+    if (new_size <= STRING_INLINE_CAPACITY)
     {
-        object_dynamic_free(runtime, data->chars);
-        *data = {};
-        return;
+        if (was_inline) {
+            data->size = new_size;
+            return NULL;
+        }
+        
+        char* old_chars = data->chars;
+        ObjectBlock* old_block = data->block;
+        
+        if (!can_discard) MemoryCopy(data->inline_chars, old_chars, new_size);
+        data->size = new_size;
+        return old_block;
     }
     
-    if (new_size <= data->capacity) return;
+    if (!was_inline && data->capacity > 0 && data->block->ref_count == 1 && new_size <= data->capacity) {
+        data->size = new_size;
+        return NULL;
+    }
     
-    data->capacity = Max(new_size, data->capacity * 2);
+    U64 old_capacity = was_inline ? STRING_INLINE_CAPACITY : data->capacity;
+    U64 capacity = Max(new_size, old_capacity * 2);
     
-    char* old_chars = data->chars;
-    char* new_chars = (char*)object_dynamic_allocate(runtime, data->capacity);
+    ObjectBlock* old_block = was_inline ? NULL : data->block;
+    ObjectBlock* new_block = ObjectBlockAlloc(runtime, capacity);
+    char* new_chars = (char*)ObjectBlockData(new_block);
     
-    if (!can_discard) MemoryCopy(new_chars, old_chars, data->size);
+    if (!can_discard) MemoryCopy(new_chars, StringDataChars(data), Min(data->size, new_size));
     
-    object_dynamic_free(runtime, old_chars);
     data->chars = new_chars;
+    data->capacity = capacity;
+    data->block = new_block;
+    data->size = new_size;
+    return old_block;
+}
+
+void ref_string_prepare(Runtime* runtime, Reference ref, U64 new_size, B32 can_discard)
+{
+    ObjectData_String* data = ref_string_get_data(runtime, ref);
+    if (data == NULL) return;
+    
+    ObjectBlockRelease(runtime, StringReserve(runtime, data, new_size, can_discard), true);
 }
 
 void ref_string_clear(Runtime* runtime, Reference ref)
 {
     ObjectData_String* data = ref_string_get_data(runtime, ref);
     if (data == NULL) return;
-    object_dynamic_free(runtime, data->chars);
+    if (!StringDataIsInline(data)) ObjectBlockRelease(runtime, data->block, true);
     *data = {};
 }
 
@@ -2463,10 +2610,12 @@ void ref_string_set(Runtime* runtime, Reference ref, String v)
     ObjectData_String* data = ref_string_get_data(runtime, ref);
     if (data == NULL) return;
     
-    ref_string_prepare(runtime, ref, v.size, true);
+    // NOTE(Jose): The old block is released after the copy, "v" might point into it
+    ObjectBlock* old_block = StringReserve(runtime, data, v.size, true);
+    
+    MemoryMove(StringDataChars(data), v.data, v.size);
     
-    MemoryCopy(data->chars, v.data, v.size);
-    data->size = v.size;
+    ObjectBlockRelease(runtime, old_block, true);
 }
 
 void ref_string_append(Runtime* runtime, Reference ref, String v)
@@ -2474,59 +2623,211 @@ void ref_string_append(Runtime* runtime, Reference ref, String v)
     ObjectData_String* data = ref_string_get_data(runtime, ref);
     if (data == NULL) return;
     
-    U64 new_size = data->size + v.size;
-    ref_string_prepare(runtime, ref, new_size, false);
+    if (v.size == 0) return;
     
-    MemoryCopy(data->chars + data->size, v.data, v.size);
-    data->size = new_size;
+    // Spilling to the heap overrides the inline chars, "v" might point into them
+    char inline_copy[STRING_INLINE_CAPACITY];
+    if (v.data >= data->inline_chars && v.data < data->inline_chars + STRING_INLINE_CAPACITY) {
+        MemoryCopy(inline_copy, v.data, v.size);
+        v.data = inline_copy;
+    }
+    
+    U64 old_size = data->size;
+    ObjectBlock* old_block = StringReserve(runtime, data, old_size + v.size, false);
+    
+    MemoryCopy(StringDataChars(data) + old_size, v.data, v.size);
+    
+    ObjectBlockRelease(runtime, old_block, true);
 }
 
-void RefArrayFree(Runtime* runtime, Reference ref, U32 capacity)
+void ref_string_set_view(Runtime* runtime, Reference ref, Reference src, U64 offset, U64 size)
 {
-    Program* program = runtime->program;
-    ObjectData_Array* array = RefGetArray(ref);
-    Type* element_type = TypeGetNext(program, ref.type);
+    ObjectData_String* data = ref_string_get_data(runtime, ref);
+    ObjectData_String* src_data = ref_string_get_data(runtime, src);
+    if (data == NULL || src_data == NULL) return;
+    
+    Assert(offset + size <= src_data->size);
+    
+    // Short views are cheaper as inline copies
+    if (size <= STRING_INLINE_CAPACITY) {
+        ref_string_set(runtime, ref, StrMake(StringDataChars(src_data) + offset, size));
+        return;
+    }
+    
+    ObjectBlock* block = src_data->block;
+    char* chars = src_data->chars + offset;
+    
+    ObjectBlockRetain(block);
+    ref_string_clear(runtime, ref);
     
-    if (VTypeNeedsInternalRelease(program, element_type))
+    data->chars = chars;
+    data->capacity = 0;
+    data->block = block;
+    data->size = size;
+}
+
+struct StringCompositionPiece {
+    String text;
+    char digits[32];
+};
+
+B32 ref_string_set_composition(Runtime* runtime, Scope* scope, Reference ref, Array<Value> sources)
+{
+    PROFILE_FUNCTION;
+    
+    ObjectData_String* data = ref_string_get_data(runtime, ref);
+    if (data == NULL) return false;
+    
+    ArenaCapture(context.arena);
+    
+    // Pieces that point into the destination would be overwritten, they are kept in scratch memory
+    char* dst_begin = StringDataIsInline(data) ? data->inline_chars : data->chars;
+    char* dst_end = dst_begin + (StringDataIsInline(data) ? STRING_INLINE_CAPACITY : data->size);
+    
+    // NOTE(Jose): Numbers are formatted into the digits of their piece, strings, bools and enum names are used from where they are.
+    // Only arrays and structs still build a temporary string
+    Array<StringCompositionPiece> pieces = ArrayAlloc<StringCompositionPiece>(context.arena, sources.count);
+    U64 total_size = 0;
+    
+    foreach(i, sources.count)
     {
-        U32 element_size = TypeGetSize(element_type);
+        Value source = sources[i];
+        StringCompositionPiece* piece = &pieces[i];
+        String text;
+        
+        if (source.kind == ValueKind_Literal && source.type == string_type) {
+            text = source.literal_string;
+        }
+        else {
+            Reference source_ref = RefFromValue(runtime, scope, source);
+            if (is_unknown(source_ref)) return false;
+            
+            if (source_ref.type == int_type) text = StrMake(piece->digits, CStrFromI64(piece->digits, RefGetSInt(source_ref)));
+            else if (source_ref.type == uint_type) text = StrMake(piece->digits, CStrFromU64(piece->digits, RefGetUInt(source_ref)));
+            else if (source_ref.type == float_type) text = StrMake(piece->digits, CStrFromF64(piece->digits, RefGetFloat(source_ref)));
+            else text = StrFromRef(context.arena, runtime, source_ref);
+        }
         
-        U8* it = array->data;
-        U8* end = array->data + element_size * array->count;
+        if (text.size > 0 && text.data < dst_end && text.data + text.size > dst_begin) {
+            text = StrCopy(context.arena, text);
+        }
         
-        while (it < end)
-        {
-            Reference member = ref_from_address(ref.parent, element_type, it);
-            ref_release_internal(runtime, member, true);
-            it += element_size;
+        piece->text = text;
+        total_size += text.size;
+    }
+    
+    ObjectBlock* old_block = StringReserve(runtime, data, total_size, true);
+    
+    char* it = StringDataChars(data);
+    foreach(i, pieces.count) {
+        MemoryCopy(it, pieces[i].text.data, pieces[i].text.size);
+        it += pieces[i].text.size;
+    }
+    
+    ObjectBlockRelease(runtime, old_block, true);
+    return true;
+}
+
+internal_fn void ArrayReleaseStorage(Runtime* runtime, ObjectData_Array* array, Type* element_type, B32 release_refs)
+{
+    ObjectBlock* block = array->block;
+    
+    if (block != NULL && array->capacity > 0)
+    {
+        if (block->ref_count == 1) {
+            ArrayReleaseElements(runtime, array->data, array->count, element_type, release_refs);
+        }
+        else {
+            // NOTE(Jose): Views are still looking at these elements, the last one releases them
+            block->orphan_count = array->count;
+            block->orphan_type = element_type;
         }
     }
     
-    object_dynamic_free(runtime, array->data);
+    ObjectBlockRelease(runtime, block, release_refs);
     *array = {};
 }
 
+void RefArrayFree(Runtime* runtime, Reference ref, U32 capacity)
+{
+    Program* program = runtime->program;
+    ObjectData_Array* array = RefGetArray(ref);
+    Type* element_type = TypeGetNext(program, ref.type);
+    
+    ArrayReleaseStorage(runtime, array, element_type, true);
+}
+
 void RefArrayPrepare(Runtime* runtime, Reference ref, U32 capacity)
 {
     Program* program = runtime->program;
     ObjectData_Array* array = RefGetArray(ref);
     
-    if (array->capacity < capacity)
+    B32 owned = array->capacity > 0 && array->block->ref_count == 1;
+    
+    if (owned && array->capacity >= capacity) return;
+    if (!owned && array->count == 0 && capacity == 0) return;
+    
+    Type* element_type = TypeGetNext(program, ref.type);
+    U32 element_size = TypeGetSize(element_type);
+    
+    ObjectData_Array last = *array;
+    
+    array->capacity = Max(capacity, last.count);
+    array->block = ObjectBlockAlloc(runtime, element_size * array->capacity);
+    array->data = (U8*)ObjectBlockData(array->block);
+    
+    if (owned)
     {
-        Type* element_type = TypeGetNext(program, ref.type);
-        U32 element_size = TypeGetSize(element_type);
-        
-        void* last_data = array->data;
-        
-        array->capacity = capacity;
-        array->data = (U8*)object_dynamic_allocate(runtime, element_size * array->capacity);
-        
-        MemoryCopy(array->data, last_data, element_size * array->count);
-        
-        if (last_data) object_dynamic_free(runtime, last_data);
+        MemoryCopy(array->data, last.data, element_size * last.count);
+        ObjectBlockRelease(runtime, last.block, true);
+    }
+    else
+    {
+        // Shared storage can't be moved, the elements are copied and the views keep the originals
+        foreach(i, last.count) {
+            Reference dst = ref_from_address(ref.parent, element_type, array->data + i * element_size);
+            Reference src = ref_from_address(ref.parent, element_type, last.data + i * element_size);
+            RefCopy(runtime, dst, src);
+        }
+        ArrayReleaseStorage(runtime, &last, element_type, true);
     }
 }
 
+void RefArrayMakeUnique(Runtime* runtime, Reference ref)
+{
+    ObjectData_Array* array = RefGetArray(ref);
+    RefArrayPrepare(runtime, ref, array->count);
+}
+
+void RefArraySetView(Runtime* runtime, Reference ref, Reference src, U32 offset, U32 count)
+{
+    Program* program = runtime->program;
+    ObjectData_Array* array = RefGetArray(ref);
+    ObjectData_Array* src_array = RefGetArray(src);
+    
+    Assert(ref.type == src.type);
+    Assert(offset + count <= src_array->count);
+    
+    Type* element_type = TypeGetNext(program, ref.type);
+    U32 element_size = TypeGetSize(element_type);
+    
+    if (count == 0) {
+        ArrayReleaseStorage(runtime, array, element_type, true);
+        return;
+    }
+    
+    ObjectBlock* block = src_array->block;
+    U8* data = src_array->data + offset * element_size;
+    
+    ObjectBlockRetain(block);
+    ArrayReleaseStorage(runtime, array, element_type, true);
+    
+    array->count = count;
+    array->capacity = 0;
+    array->data = data;
+    array->block = block;
+}
+
 void set_reference(Runtime* runtime, Reference ref, Reference src)
 {
     Program* program = runtime->program;
@@ -2816,24 +3117,7 @@ void ref_release_internal(Runtime* runtime, Reference ref, B32 release_refs)
     {
         ObjectData_Array* array = RefGetArray(ref);
         Type* element_type = TypeGetNext(program, type);
-        
-        if (VTypeNeedsInternalRelease(program, element_type))
-        {
-            U32 element_size = TypeGetSize(element_type);
-            
-            U8* it = array->data;
-            U8* end = array->data + element_size * array->count;
-            
-            while (it < end)
-            {
-                Reference member = ref_from_address(ref.parent, element_type, it);
-                ref_release_internal(runtime, member, release_refs);
-                it += element_size;
-            }
-        }
-        
-        object_dynamic_free(runtime, array->data);
-        *array = {};
+        ArrayReleaseStorage(runtime, array, element_type, release_refs);
     }
     else if (type->kind == VKind_Struct)
     {
@@ -2892,7 +3176,15 @@ void RefCopy(Runtime* runtime, Reference dst, Reference src)
     {
         if (type == string_type)
         {
-            ref_string_set(runtime, dst, get_string(src));
+            ObjectData_String* src_data = ref_string_get_data(runtime, src);
+            
+            // Heap chars are shared, the first mutation of any of the copies makes its own block
+            if (!StringDataIsInline(src_data)) {
+                ref_string_set_view(runtime, dst, src, 0, src_data->size);
+            }
+            else {
+                ref_string_set(runtime, dst, get_string(src));
+            }
         }
         else {
             I64* v0 = (I64*)dst.address;
@@ -2902,14 +3194,18 @@ void RefCopy(Runtime* runtime, Reference dst, Reference src)
     }
     else if (type->kind == VKind_Array)
     {
+        ObjectData_Array* src_array = RefGetArray(src);
+        
+        if (src_array->capacity == 0 && src_array->block != NULL) {
+            RefArraySetView(runtime, dst, src, 0, src_array->count);
+            return;
+        }
+        
         ref_release_internal(runtime, dst, true);
         
         ObjectData_Array* dst_array = RefGetArray(dst);
-        ObjectData_Array* src_array = RefGetArray(src);
         
-        U32 element_size = TypeGetSize(TypeGetNext(program, type));
-        dst_array->capacity = src_array->count;
-        dst_array->data = (U8*)object_dynamic_allocate(runtime, dst_array->capacity * element_size);
+        RefArrayPrepare(runtime, dst, src_array->count);
         dst_array->count = src_array->count;
         
         foreach(i, dst_array->count) {
@@ -86,10 +86,12 @@ Reference RefFromValue(Runtime* runtime, Scope* scope, Value value);
 void RunInstruction(Runtime* runtime, Unit unit);
 void RunStore(Runtime* runtime, I32 dst_index, Reference src);
 void RunCopy(Runtime* runtime, I32 dst_index, Reference src);
+void RunAppend(Runtime* runtime, I32 dst_index, Reference src);
+void RunCopyStringComposition(Runtime* runtime, I32 dst_index, Value src);
 void RunReturn(Runtime* runtime);
 void RunJump(Runtime* runtime, Reference ref, I32 condition, I32 offset);
 void RunFunctionCall(Runtime* runtime, I32 dst_index, FunctionDefinition* fn, Array<Value> parameters);
-void RunChild(Runtime* runtime, I32 dst_index, Reference src, Reference index, B32 is_member);
+void RunChild(Runtime* runtime, I32 dst_index, Reference src, Reference index, B32 is_member, B32 is_write);
 
 void RunAdd(Runtime* runtime, I32 dst_index, PrimitiveType type, Reference left, Reference right);
 void RunSub(Runtime* runtime, I32 dst_index, PrimitiveType type, Reference left, Reference right);
@@ -191,9 +193,13 @@ void ref_string_prepare(Runtime* runtime, Reference ref, U64 new_size, B32 can_d
 void ref_string_clear(Runtime* runtime, Reference ref);
 void ref_string_set(Runtime* runtime, Reference ref, String v);
 void ref_string_append(Runtime* runtime, Reference ref, String v);
+void ref_string_set_view(Runtime* runtime, Reference ref, Reference src, U64 offset, U64 size);
+B32 ref_string_set_composition(Runtime* runtime, Scope* scope, Reference ref, Array<Value> sources);
 
 void RefArrayFree(Runtime* runtime, Reference ref, U32 capacity);
 void RefArrayPrepare(Runtime* runtime, Reference ref, U32 capacity);
+void RefArrayMakeUnique(Runtime* runtime, Reference ref);
+void RefArraySetView(Runtime* runtime, Reference ref, Reference src, U32 offset, U32 count);
 
 void set_reference(Runtime* runtime, Reference ref, Reference src);
 
@@ -238,6 +244,11 @@ Reference ref_alloc_and_copy(Runtime* runtime, Reference src);
 
 void* object_dynamic_allocate(Runtime* runtime, U64 size);
 void object_dynamic_free(Runtime* runtime, void* ptr);
+
+ObjectBlock* ObjectBlockAlloc(Runtime* runtime, U64 size);
+void* ObjectBlockData(ObjectBlock* block);
+void ObjectBlockRetain(ObjectBlock* block);
+void ObjectBlockRelease(Runtime* runtime, ObjectBlock* block, B32 release_refs);
 void object_free_unused_memory(Runtime* runtime);
 void ObjectFreeAll(Runtime* runtime);
 
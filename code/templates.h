@@ -53,20 +53,7 @@ template<typename T>
 struct BArray : BBuffer {
     inline T& operator[](U32 index)
     {
-        Assert(index < count);
-        
-        BBufferBlock* block = root;
-        
-        while (index >= block->capacity)
-        {
-            index -= block->capacity;
-            block = block->next;
-            Assert(block != NULL);
-        }
-        
-        T* data = (T*)(block + 1);
-        
-        return data[index];
+        return *(T*)BBufferGet(this, index);
     }
 };
 
@@ -180,18 +167,7 @@ inline_fn void operator--(BArrayIterator<T>& it)
     if (it.block_index > 0) it.block_index--;
     else
     {
-        BBufferBlock* block = it.array->root;
-        U32 index = it.index;
-        
-        while (index >= block->capacity)
-        {
-            index -= block->capacity;
-            block = block->next;
-            Assert(block != NULL);
-        }
-        
-        it.block = block;
-        it.block_index = index;
+        it.block = it.array->blocks[BBufferBlockFromIndex(it.array, it.index, &it.block_index)];
     }
     
     Assert(it.block_index < it.block->count);
@@ -348,4 +324,242 @@ inline_fn void ArraySort(Array<T> array, SortCompareFn* fn)
 	else {
 		_InsertionSort(array, fn, 0, array.count);
 	}
-}
\ No newline at end of file
+}
+// Pattern-defeating quicksort. "less" is any callable with the signature B32(const T&, const T&)
+
+#define PDQ_INSERTION_SORT_THRESHOLD 24
+#define PDQ_NINTHER_THRESHOLD 128
+#define PDQ_PARTIAL_INSERTION_SORT_LIMIT 8
+
+template<typename T, typename F>
+internal_fn void _PdqInsertionSort(T* begin, T* end, F& less, B32 unguarded)
+{
+    if (begin == end) return;
+    
+    for (T* cur = begin + 1; cur != end; ++cur)
+    {
+        T* sift = cur;
+        T* sift_1 = cur - 1;
+        
+        if (less(*sift, *sift_1))
+        {
+            T tmp = *sift;
+            
+            if (unguarded) {
+                do { *sift-- = *sift_1; } while (less(tmp, *--sift_1));
+            }
+            else {
+                do { *sift-- = *sift_1; } while (sift != begin && less(tmp, *--sift_1));
+            }
+            
+            *sift = tmp;
+        }
+    }
+}
+
+template<typename T, typename F>
+internal_fn B32 _PdqPartialInsertionSort(T* begin, T* end, F& less)
+{
+    if (begin == end) return true;
+    
+    U64 limit = 0;
+    for (T* cur = begin + 1; cur != end; ++cur)
+    {
+        T* sift = cur;
+        T* sift_1 = cur - 1;
+        
+        if (less(*sift, *sift_1))
+        {
+            T tmp = *sift;
+            do { *sift-- = *sift_1; } while (sift != begin && less(tmp, *--sift_1));
+            *sift = tmp;
+            
+            limit += cur - sift;
+            if (limit > PDQ_PARTIAL_INSERTION_SORT_LIMIT) return false;
+        }
+    }
+    return true;
+}
+
+template<typename T, typename F>
+internal_fn void _PdqSort2(T* a, T* b, F& less) {
+    if (less(*b, *a)) Swap(*a, *b);
+}
+
+template<typename T, typename F>
+internal_fn void _PdqSort3(T* a, T* b, T* c, F& less) {
+    _PdqSort2(a, b, less);
+    _PdqSort2(b, c, less);
+    _PdqSort2(a, b, less);
+}
+
+// Partitions [begin, end) around *begin, elements equal to the pivot go to the right side
+template<typename T, typename F>
+internal_fn T* _PdqPartitionRight(T* begin, T* end, F& less, B32* already_partitioned)
+{
+    T pivot = *begin;
+    T* first = begin;
+    T* last = end;
+    
+    while (less(*++first, pivot));
+    
+    if (first - 1 == begin) while (first < last && !less(*--last, pivot));
+    else while (!less(*--last, pivot));
+    
+    *already_partitioned = first >= last;
+    
+    while (first < last) {
+        Swap(*first, *last);
+        while (less(*++first, pivot));
+        while (!less(*--last, pivot));
+    }
+    
+    T* pivot_pos = first - 1;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+    return pivot_pos;
+}
+
+// Same as above but elements equal to the pivot go to the left side, used to skip runs of equal keys
+template<typename T, typename F>
+internal_fn T* _PdqPartitionLeft(T* begin, T* end, F& less)
+{
+    T pivot = *begin;
+    T* first = begin;
+    T* last = end;
+    
+    while (less(pivot, *--last));
+    
+    if (last + 1 == end) while (first < last && !less(pivot, *++first));
+    else while (!less(pivot, *++first));
+    
+    while (first < last) {
+        Swap(*first, *last);
+        while (less(pivot, *--last));
+        while (!less(pivot, *++first));
+    }
+    
+    T* pivot_pos = last;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+    return pivot_pos;
+}
+
+template<typename T, typename F>
+internal_fn void _PdqHeapSort(T* begin, T* end, F& less)
+{
+    U64 count = end - begin;
+    
+    auto sift_down = [&](U64 root, U64 size) {
+        while (1) {
+            U64 child = root * 2 + 1;
+            if (child >= size) break;
+            if (child + 1 < size && less(begin[child], begin[child + 1])) child++;
+            if (!less(begin[root], begin[child])) break;
+            Swap(begin[root], begin[child]);
+            root = child;
+        }
+    };
+    
+    for (U64 i = count / 2; i > 0; --i) sift_down(i - 1, count);
+    
+    for (U64 i = count - 1; i > 0; --i) {
+        Swap(begin[0], begin[i]);
+        sift_down(0, i);
+    }
+}
+
+template<typename T, typename F>
+internal_fn void _PdqSortLoop(T* begin, T* end, F& less, I32 bad_allowed, B32 leftmost)
+{
+    while (1)
+    {
+        U64 size = end - begin;
+        
+        if (size < PDQ_INSERTION_SORT_THRESHOLD) {
+            _PdqInsertionSort(begin, end, less, !leftmost);
+            return;
+        }
+        
+        // Choose pivot as median of 3 or pseudo-median of 9
+        U64 s2 = size / 2;
+        if (size > PDQ_NINTHER_THRESHOLD) {
+            _PdqSort3(begin, begin + s2, end - 1, less);
+            _PdqSort3(begin + 1, begin + (s2 - 1), end - 2, less);
+            _PdqSort3(begin + 2, begin + (s2 + 1), end - 3, less);
+            _PdqSort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), less);
+            Swap(*begin, *(begin + s2));
+        }
+        else {
+            _PdqSort3(begin + s2, begin, end - 1, less);
+        }
+        
+        // If the previous partition pivot is equal to this one all the elements of this range are equal to it
+        if (!leftmost && !less(*(begin - 1), *begin)) {
+            begin = _PdqPartitionLeft(begin, end, less) + 1;
+            continue;
+        }
+        
+        B32 already_partitioned;
+        T* pivot_pos = _PdqPartitionRight(begin, end, less, &already_partitioned);
+        
+        U64 l_size = pivot_pos - begin;
+        U64 r_size = end - (pivot_pos + 1);
+        B32 highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+        
+        if (highly_unbalanced)
+        {
+            if (--bad_allowed == 0) {
+                _PdqHeapSort(begin, end, less);
+                return;
+            }
+            
+            // Break patterns
+            if (l_size >= PDQ_INSERTION_SORT_THRESHOLD) {
+                Swap(begin[0], begin[l_size / 4]);
+                Swap(pivot_pos[-1], pivot_pos[-(I64)(l_size / 4)]);
+                
+                if (l_size > PDQ_NINTHER_THRESHOLD) {
+                    Swap(begin[1], begin[l_size / 4 + 1]);
+                    Swap(begin[2], begin[l_size / 4 + 2]);
+                    Swap(pivot_pos[-2], pivot_pos[-(I64)(l_size / 4 + 1)]);
+                    Swap(pivot_pos[-3], pivot_pos[-(I64)(l_size / 4 + 2)]);
+                }
+            }
+            
+            if (r_size >= PDQ_INSERTION_SORT_THRESHOLD) {
+                Swap(pivot_pos[1], pivot_pos[1 + r_size / 4]);
+                Swap(end[-1], end[-(I64)(r_size / 4)]);
+                
+                if (r_size > PDQ_NINTHER_THRESHOLD) {
+                    Swap(pivot_pos[2], pivot_pos[2 + r_size / 4]);
+                    Swap(pivot_pos[3], pivot_pos[3 + r_size / 4]);
+                    Swap(end[-2], end[-(I64)(1 + r_size / 4)]);
+                    Swap(end[-3], end[-(I64)(2 + r_size / 4)]);
+                }
+            }
+        }
+        else
+        {
+            // Likely sorted input, try to finish with a bounded insertion sort
+            if (already_partitioned && _PdqPartialInsertionSort(begin, pivot_pos, less) && _PdqPartialInsertionSort(pivot_pos + 1, end, less)) {
+                return;
+            }
+        }
+        
+        _PdqSortLoop(begin, pivot_pos, less, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+template<typename T, typename F>
+inline_fn void ArraySortPdq(Array<T> array, F less)
+{
+    if (array.count <= 1) return;
+    
+    I32 bad_allowed = 0;
+    for (U32 n = array.count; n > 1; n >>= 1) bad_allowed++;
+    
+    _PdqSortLoop(array.data, array.data + array.count, less, bad_allowed, true);
+}
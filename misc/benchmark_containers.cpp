@@ -0,0 +1,131 @@
+#include "common.h"
+
+// NOTE(Jose): Container microbenchmarks, built and run by benchmark_containers.yov
+
+#define ELEMENT_COUNT (1 << 20)
+#define REPEAT 8
+
+struct Element {
+    U64 key;
+    U64 value;
+};
+
+internal_fn F64 SecondsFromTimer(U64 start)
+{
+    return (F64)(OsTimerGet() - start) / (F64)system_info.timer_frequency;
+}
+
+internal_fn void PrintResult(const char* name, U64 start, U64 checksum)
+{
+    F64 seconds = SecondsFromTimer(start);
+    F64 ns = seconds * 1000000000.0 / (F64)(ELEMENT_COUNT * REPEAT);
+    PrintF("%s: %.2f ns/op (%l)\n", name, ns, (I64)checksum);
+}
+
+internal_fn void BenchmarkArray(Arena* arena)
+{
+    Array<Element> array = ArrayAlloc<Element>(arena, ELEMENT_COUNT);
+    
+    U64 start = OsTimerGet();
+    U64 checksum = 0;
+    foreach(r, REPEAT) {
+        foreach(i, array.count) array[i] = { i, r };
+    }
+    PrintResult("Array write", start, array.count);
+    
+    start = OsTimerGet();
+    foreach(r, REPEAT) {
+        foreach(i, array.count) checksum += array[i].key;
+    }
+    PrintResult("Array index", start, checksum);
+}
+
+internal_fn void BenchmarkBArray(Arena* arena, U32 block_capacity)
+{
+    PrintF("BArray, %u elements per block:\n", block_capacity);
+    
+    U64 start = OsTimerGet();
+    U64 checksum = 0;
+    foreach(r, REPEAT) {
+        ArenaCapture(arena);
+        BArray<Element> array = BArrayMake<Element>(arena, block_capacity);
+        foreach(i, ELEMENT_COUNT) BArrayAdd(&array, { i, r });
+        checksum += array.count;
+    }
+    PrintResult("    add", start, checksum);
+    
+    BArray<Element> array = BArrayMake<Element>(arena, block_capacity);
+    foreach(i, ELEMENT_COUNT) BArrayAdd(&array, { i, 0 });
+    
+    start = OsTimerGet();
+    checksum = 0;
+    foreach(r, REPEAT) {
+        foreach(i, array.count) checksum += array[i].key;
+    }
+    PrintResult("    index", start, checksum);
+    
+    // Strided so consecutive accesses land on different blocks
+    start = OsTimerGet();
+    checksum = 0;
+    foreach(r, REPEAT) {
+        U32 index = r;
+        foreach(i, array.count) {
+            checksum += array[index].key;
+            index = (index + 7919) & (ELEMENT_COUNT - 1);
+        }
+    }
+    PrintResult("    random index", start, checksum);
+    
+    start = OsTimerGet();
+    checksum = 0;
+    foreach(r, REPEAT) {
+        foreach_BArray(it, &array) checksum += it.value->key;
+    }
+    PrintResult("    iterate", start, checksum);
+    
+    start = OsTimerGet();
+    checksum = 0;
+    foreach(r, REPEAT) {
+        ArenaCapture(context.arena);
+        Array<Element> copy = ArrayFromBArray(context.arena, array);
+        checksum += copy[copy.count - 1].key;
+    }
+    PrintResult("    to array", start, checksum);
+}
+
+internal_fn void BenchmarkBBuffer(Arena* arena)
+{
+    BBuffer buffer = BBufferMake(arena, sizeof(U32), 64);
+    
+    U64 start = OsTimerGet();
+    foreach(r, REPEAT) {
+        BBufferReset(&buffer);
+        foreach(i, ELEMENT_COUNT) *(U32*)BBufferAdd(&buffer) = i;
+    }
+    PrintResult("BBuffer add", start, buffer.count);
+    
+    start = OsTimerGet();
+    U64 checksum = 0;
+    foreach(r, REPEAT) {
+        foreach(i, buffer.count) checksum += *(U32*)BBufferGet(&buffer, i);
+    }
+    PrintResult("BBuffer get", start, checksum);
+}
+
+int main()
+{
+    SetupGlobals();
+    
+    Arena* arena = ArenaAlloc(Gb(32), 8, "Arena Benchmark");
+    
+    PrintF("Containers, %u elements x%u\n", ELEMENT_COUNT, REPEAT);
+    
+    BenchmarkArray(arena);
+    BenchmarkBBuffer(arena);
+    BenchmarkBArray(arena, 16);
+    BenchmarkBArray(arena, 256);
+    
+    ArenaFree(arena);
+    ShutdownGlobals();
+    return 0;
+}